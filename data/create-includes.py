@@ -3,7 +3,10 @@
 # Extracts rules, enums and enum strings from timezonedb.com CSV files (https://timezonedb.com/files/timezonedb.csv.zip)
 # timezonedb.com CSV files are themselves extracted from the well respected IANA database (https://www.iana.org/time-zones)
 #
+import bisect
+import calendar
 import csv
+import datetime
 import enum
 import os
 import re
@@ -17,11 +20,20 @@ class History(enum.Enum):
 # Set as required...
 history = History.DEFAULT
 
+# Rules in effect from this many years before now on are packed together for all time zones, with earlier rules kept apart (see RulesBase::RulesType)...
+hotYears = 10
+
 zones = {}
+zoneCountries = {}
 with open("csv/zone.csv") as csvfile:
     r = csv.reader(csvfile)
     for row in r:
         zones[int(row[0])] = row[2]
+        zoneCountries[int(row[0])] = row[1]
+
+# ISO 3166-1 alpha-2 codes, ordered so Country enumerators are too...
+with open("csv/country.csv", encoding="utf-8") as csvfile:
+    countries = sorted(row[0] for row in csv.reader(csvfile))
 
 def abbreviationFix(match):
     s = match.group(0)
@@ -49,10 +61,137 @@ indent = " " * 4
 if not os.path.exists("etz-data"):
     os.mkdir("etz-data")
    
+# Years for the year index are mean Gregorian years (Civil::SecondsPerYear) counted from 1970, so UTC::search can find one with a single division...
+SecondsPerYear = 31556952
+
+def year(t):
+    return t // SecondsPerYear
+
+def yearStart(y):
+    return y * SecondsPerYear
+
+# Recurring transitions, as RulesBase::Transition, times as UTC::transitionTime...
+def transitionTime(transition, y, previousOffset):
+    day = transition["day"] if transition["day"] else calendar.monthrange(y, transition["month"])[1] - 6
+    days = datetime.date(y, transition["month"], day).toordinal() - datetime.date(1970, 1, 1).toordinal()
+    weekday = (transition["weekday"] - (days + 4) % 7) % 7
+    return (days + weekday) * 86400 + transition["localSeconds"] - previousOffset
+
+def utcYear(t):
+    return (datetime.datetime(1970, 1, 1) + datetime.timedelta(seconds=t)).year
+
+Week = 7 * 86400
+
+# Describes rules alternating between two transitions each year as a recurrence, or returns None when they don't...
+def findRecurrence(rules):
+    if len(rules) < 4:
+        return None
+    times = [int(rule["startTime"][:-2]) for rule in rules]
+    transitions = []
+    for i in range(2):
+        previousOffset = int(rules[1 - i]["gmtOffset"])
+        walls = [datetime.datetime(1970, 1, 1) + datetime.timedelta(seconds=times[j] + previousOffset) for j in range(i, len(rules), 2)]
+        last = all(w.day + 7 > calendar.monthrange(w.year, w.month)[1] for w in walls)
+        w = walls[-1]
+        transitions.append({ "month": w.month, "day": 0 if last else max(max(w.day for w in walls) - 6, 1), "weekday": w.isoweekday() % 7,
+            "localSeconds": w.hour * 3600 + w.minute * 60 + w.second, "rule": rules[i] })
+    if (transitions[1]["month"], transitions[1]["day"]) < (transitions[0]["month"], transitions[0]["day"]):
+        transitions.reverse()
+
+    # Accept only if it reproduces every rule, with both transitions of a year at least a week inside that UTC year so UTC::intervalLu can
+    # estimate the year...
+    #
+    expected = []
+    for y in range(utcYear(times[0]), utcYear(times[-1]) + 1):
+        first = transitionTime(transitions[0], y, int(transitions[1]["rule"]["gmtOffset"]))
+        second = transitionTime(transitions[1], y, int(transitions[0]["rule"]["gmtOffset"]))
+        if not (first < second and first >= calendar.timegm((y, 1, 1, 0, 0, 0)) + Week and second < calendar.timegm((y + 1, 1, 1, 0, 0, 0)) - Week):
+            return None
+        expected += [(first, transitions[0]["rule"]), (second, transitions[1]["rule"])]
+    expected = [(t, rule) for t, rule in expected if times[0] <= t <= times[-1]]
+    if len(expected) != len(rules):
+        return None
+    for (t, rule), actual in zip(expected, rules):
+        if t != int(actual["startTime"][:-2]) or any(rule[k] != actual[k] for k in ("abbreviation", "gmtOffset", "isDST")):
+            return None
+    return transitions
+
+# Finds the longest run of rules recurring to the end of the data, returning where it starts and its recurrence, or (len(rules), None). Runs
+# start where the rules stop alternating between the same two, though a change of day within a month shows only when the recurrence is checked...
+#
+def findTail(rules, endYear):
+    if len(rules) < 4 or utcYear(int(rules[-1]["startTime"][:-2])) < endYear - 1:
+        return len(rules), None
+    def same(a, b):
+        return all(a[k] == b[k] for k in ("abbreviation", "gmtOffset", "isDST"))
+    start = len(rules) - 2
+    while start > 0 and same(rules[start - 1], rules[start + 1]) and not same(rules[start - 1], rules[start]):
+        start -= 1
+    for i in range(start, len(rules) - 3):
+        recurrence = findRecurrence(rules[i:])
+        if recurrence:
+            return i, recurrence
+    return len(rules), None
+
+def writeRecurrence(recurrence):
+    return "{ { " + ", ".join("{{ {}, {}, {}, {}, Abbreviation::{}, {}, {} }}".format(t["month"], t["day"], t["weekday"], t["localSeconds"],
+        t["rule"]["abbreviation"], t["rule"]["gmtOffset"], t["rule"]["isDST"]) for t in recurrence) + " } }"
+
+def writeArray(type, name, values, perLine = 1):
+    values = values or ["{}"] # arrays may not be empty
+    s = "static constexpr {} {}[] = {{\n".format(type, name)
+    s += ",\n".join(indent + ", ".join(str(v) for v in values[j:j + perLine]) for j in range(0, len(values), perLine))
+    return s + "\n};\n"
+
+# The arrays of a table of rules, see RulesBase::RulesType...
+def tableArrays(rules):
+    startTimes = [int(rule["startTime"][:-2]) for rule in rules]
+
+    # Year index, the rule in effect at the start of each year from that of the first rule to that of the last...
+    firstYear = year(startTimes[0])
+    years = []
+    for y in range(firstYear, year(startTimes[-1]) + 1):
+        years.append(max(bisect.bisect_right(startTimes, yearStart(y)) - 1, 0))
+
+    # Compact alternative (see UTC::compactIntervalLu), an entry per rule followed by a palette of the rest of the rules. Each entry is the time
+    # from the start of the year before the first in the index to have the rule in effect (or the last year if none do), the first rule's from
+    # firstYear...
+    #
+    palette = []
+    entries = []
+    for j, rule in enumerate(rules):
+        rest = "Rule::data(0, Abbreviation::{abbreviation}, {gmtOffset}, {isDST})".format(**rule)
+        if rest not in palette:
+            palette.append(rest)
+        y = firstYear if j == 0 else firstYear + bisect.bisect_left(years, j) - 1
+        entries.append("{}u << 7 | {}".format(startTimes[j] - yearStart(y), palette.index(rest)))
+        assert 0 <= startTimes[j] - yearStart(y) <= SecondsPerYear and len(palette) <= 128
+
+    return { "keys": ["Rule::key({})".format(rule["startTime"]) for rule in rules],
+        "data": ["Rule::data({})".format(", ".join(str(v) if k != "abbreviation" else f"Abbreviation::{v}" for k, v in rule.items())) for rule in rules],
+        "years": years, "firstYear": firstYear, "compact": entries + palette }
+
+def writeTable(keys, data, compact, count, firstYear, years, countYears, recurrence, history):
+    rest = ", {}, {}".format(recurrence or "nullptr", history) if history else ", " + recurrence if recurrence else ""
+    return "EnableCompactRules ? Compact({2}, {3}, {4}, {5}, {6}{7}) : Table({0}, {1}, {3}, {4}, {5}, {6}{7})".format(
+        keys, data, compact, count, firstYear, years, countYears, rest)
+
 # Write the rules include...
 f = open("etz-data/rules.inl", "w")
 
 now = time.time()
+endYear = max(utcYear(int(rule["startTime"][:-2])) for v in timezones.values() for rule in v["rules"])
+hotStart = yearStart(year(now) - hotYears)
+hot = { "keys": [], "data": [], "compact": [], "years": [], "recurrences": [], "fixedKeys": [], "fixedData": [] }
+countRules = 0
+countCompact = 0
+countYears = 0
+countTails = 0
+countHistoryRules = 0
+countHistoryYears = 0
+strategies = {}
+histories = {}
+shares = [0]
 for k, v in timezones.items():
     def filterRule(rule):
         startTime = int(rule["startTime"][:-2])
@@ -65,15 +204,159 @@ for k, v in timezones.items():
 
     allRules = v["rules"]
     rules = list(filter(filterRule, allRules))
-    _timezone = "static constexpr Rule {}[] = {{\n".format(re.sub("[/-]", "_", v["name"]))
-    _timezone += ",\n".join((indent + "Rule({})".format(", ".join(str(v) if k != "abbreviation" else f"Abbreviation::{v}" for k, v in rule.items())) for rule in (rules if len(rules) > 0 else [allRules[-1]])))
-    _timezone += "\n};\n\n"
-    f.write(_timezone)
+    if len(rules) == 0:
+        rules = [allRules[-1]]
+
+    # Classify the time zone (see RulesBase::Strategy). Rules recurring to the end of the data are kept as a recurrence after the first of them,
+    # which ends a table or, when all the rules recur, is the only rule of a periodic time zone (covering any earlier time, as the first rule of a
+    # table does). The year before the end allows for the data ending part way through a year...
+    #
+    name = re.sub("[/-]", "_", v["name"])
+    tail, recurrence = findTail(rules, endYear)
+    if recurrence:
+        rules = rules[:tail + 1]
+
+    # Time zones with the same history share the arrays of the first of them, TimeZoneShares maps each to it...
+    signature = (tuple(tuple(rule.items()) for rule in rules),
+        tuple((t["month"], t["day"], t["weekday"], t["localSeconds"]) + tuple(t["rule"][k] for k in ("abbreviation", "gmtOffset", "isDST")) for t in recurrence or []))
+    if signature in histories:
+        shared = histories[signature]
+        v["strategy"] = shared["strategy"]
+        shares.append(shared["ordinal"])
+        strategies[shared["kind"]] += 1
+        countTails += shared["tail"]
+        continue
+    histories[signature] = v
+    v["ordinal"] = len(shares)
+    shares.append(v["ordinal"])
 
-f.write("static constexpr std::pair<TimeZone, RulesType> TimeZoneRules[] = {\n");
-f.write(",\n".join(indent + """std::make_pair(TimeZone::{0}, Rules({0}))""".format(re.sub("[/-]", "_", v["name"])) for v in timezones.values()))
+    recurrenceArgument = None
+    if recurrence:
+        recurrenceArgument = "&Recurrences[{}]".format(len(hot["recurrences"]))
+        hot["recurrences"].append(writeRecurrence(recurrence))
+
+    if len(rules) == 1:
+        strategy = "Periodic" if recurrence else "Fixed"
+        fixed = "FixedKeys + {0}, FixedData + {0}".format(len(hot["fixedKeys"]))
+        v["strategy"] = "Periodic({}, {})".format(fixed, recurrenceArgument[1:]) if recurrence else "Fixed({})".format(fixed)
+        table = tableArrays(rules)
+        hot["fixedKeys"] += table["keys"]
+        hot["fixedData"] += table["data"]
+        countRules += 1
+        countCompact += 2
+    else:
+        # Rules before the one in effect at hotStart are history, a table of their own ending with that rule so its intervals end where the hot
+        # rules begin...
+        #
+        strategy = "Table"
+        first = max(bisect.bisect_right([int(rule["startTime"][:-2]) for rule in rules], hotStart) - 1, 0)
+        historyArgument = None
+        if first > 0:
+            cold = tableArrays(rules[:first + 1])
+            f.write(writeArray("int32_t", name + "_Keys", cold["keys"]))
+            f.write(writeArray("uint32_t", name + "_Data", cold["data"]))
+            f.write(writeArray("uint32_t", name + "_Compact", cold["compact"]))
+            f.write(writeArray("uint16_t", name + "_Years", cold["years"], 16))
+            f.write("static constexpr RulesType {}_History = {};\n\n".format(name, writeTable(name + "_Keys", name + "_Data", name + "_Compact", first + 1,
+                cold["firstYear"], name + "_Years", len(cold["years"]), None, None)))
+            historyArgument = "&{}_History".format(name)
+            countRules += first + 1
+            countCompact += len(cold["compact"])
+            countYears += len(cold["years"])
+            countHistoryRules += first + 1
+            countHistoryYears += len(cold["years"])
+
+        table = tableArrays(rules[first:])
+        v["strategy"] = writeTable("HotKeys + {}".format(len(hot["keys"])), "HotData + {}".format(len(hot["keys"])), "HotCompact + {}".format(len(hot["compact"])),
+            len(rules) - first, table["firstYear"], "HotYears + {}".format(len(hot["years"])), len(table["years"]), recurrenceArgument, historyArgument)
+        for key in ("keys", "data", "compact", "years"):
+            hot[key] += table[key]
+        countRules += len(rules) - first
+        countCompact += len(table["compact"])
+        countYears += len(table["years"])
+
+    v["kind"] = strategy
+    v["tail"] = int(strategy == "Table" and recurrence is not None)
+    strategies[strategy] = strategies.get(strategy, 0) + 1
+
+# Everything in effect from hotStart on, packed together...
+f.write(writeArray("Recurrence", "Recurrences", hot["recurrences"]))
+f.write(writeArray("int32_t", "FixedKeys", hot["fixedKeys"]))
+f.write(writeArray("uint32_t", "FixedData", hot["fixedData"]))
+f.write(writeArray("int32_t", "HotKeys", hot["keys"]))
+f.write(writeArray("uint32_t", "HotData", hot["data"]))
+f.write(writeArray("uint32_t", "HotCompact", hot["compact"]))
+f.write(writeArray("uint16_t", "HotYears", hot["years"], 16))
+
+# Dense index ordered by TimeZone ordinal (the enum below is written in the same order), the first entry is TimeZone::Invalid...
+f.write("static constexpr RulesType TimeZoneRules[] = {\n");
+f.write(",\n".join([indent + "RulesType()"] + [indent + v["strategy"] for v in timezones.values()]))
 f.write("\n};\n")
+f.write(writeArray("uint16_t", "TimeZoneShares", shares, 16))
+
+# Rules and years of all the histories, each counted once, as the history tables are only reachable through pointers...
+f.write("static constexpr size_t CountHistoryRules = {};\n".format(countHistoryRules))
+f.write("static constexpr size_t CountHistoryYears = {};\n".format(countHistoryYears))
 f.close()
+print("Rules: {} ({} bytes, {} bytes compact), year index: {} bytes".format(countRules, countRules * 8, countCompact * 4, countYears * 2))
+print("Hot rules from {}: {} ({} bytes, {} bytes compact), year index: {} bytes".format(utcYear(hotStart), len(hot["keys"]) + len(hot["fixedKeys"]),
+    (len(hot["keys"]) + len(hot["fixedKeys"])) * 8, (len(hot["compact"]) + len(hot["fixedKeys"]) * 2) * 4, len(hot["years"]) * 2))
+print("Histories: {} for {} time zones ({:.2f} time zones per history)".format(len(histories), len(timezones), len(timezones) / len(histories)))
+print("Time zones: " + ", ".join("{} {}".format(k, v) for k, v in sorted(strategies.items())) + ", tables with a recurring tail {}".format(countTails + sum(v["tail"] for v in histories.values())))
+
+# 32 bit FNV-1a of a name from a seeded basis, as Enums::hash...
+def nameHash(seed, name):
+    h = (2166136261 ^ seed) & 0xffffffff
+    for c in name.encode():
+        h = ((h ^ c) * 16777619) & 0xffffffff
+    return h
+
+# Minimal perfect hash by hash and displace: names are bucketed by their unseeded hash and, largest bucket first, each bucket is given the first seed
+# that sends all of its names to free slots. Buckets of one name take a free slot directly, recorded as -1 - slot, see Enums::key...
+def perfectHash(names):
+    n = len(names)
+    buckets = [[] for _ in range(n)]
+    for ordinal, name in enumerate(names):
+        buckets[nameHash(0, name) % n].append(ordinal)
+    seeds = [0] * n
+    slots = [None] * n
+    for b in sorted(range(n), key=lambda b: -len(buckets[b])):
+        bucket = buckets[b]
+        if len(bucket) <= 1:
+            break
+        seed = 1
+        while True:
+            placed = [nameHash(seed, names[ordinal]) % n for ordinal in bucket]
+            if len(set(placed)) == len(placed) and all(slots[i] is None for i in placed):
+                break
+            seed += 1
+        assert seed < 32768
+        seeds[b] = seed
+        for ordinal, i in zip(bucket, placed):
+            slots[i] = ordinal
+    free = [i for i in range(n) if slots[i] is None]
+    for b in range(n):
+        if len(buckets[b]) == 1:
+            i = free.pop()
+            seeds[b] = -1 - i
+            slots[i] = buckets[b][0]
+    return seeds, slots
+
+# Names are pooled as one block of null terminated strings with the offset of each, and of the end of the pool, so they need no pointers and so no
+# relocations (see Enums)...
+def writeNames(prefix, names):
+    seeds, slots = perfectHash(names)
+    offsets = [0]
+    for name in names:
+        offsets.append(offsets[-1] + len(name) + 1)
+    assert offsets[-1] < 65536
+    s = "static constexpr char {}Names[] =\n".format(prefix)
+    s += "\n".join(indent + '"{}\\0"'.format(name) for name in names)
+    s += ";\n"
+    s += writeArray("uint16_t", prefix + "NameOffsets", offsets, 16)
+    s += writeArray("int16_t", prefix + "HashSeeds", seeds, 16)
+    s += writeArray("uint16_t", prefix + "HashSlots", slots, 16)
+    return s
 
 # Write the abbreviation includes (enum + names)...
 begin = [ "Invalid" ]
@@ -86,9 +369,7 @@ f.write("\n};\n")
 f.close()
 
 f = open("etz-data/abbreviation-names.inl", "w")
-f.write("static constexpr const char* AbbreviationNames[] {\n")
-f.write(",\n".join(indent + f'"{a}"' for a in begin + list(abbreviations)))
-f.write("\n};\n")
+f.write(writeNames("Abbreviation", begin + list(abbreviations)))
 f.close()
 
 # Write the timezones includes (enum + names)...
@@ -102,7 +383,33 @@ f.write("\n};\n")
 f.close()
 
 f = open("etz-data/timezone-names.inl", "w")
-f.write("static constexpr const char* TimeZoneNames[] {\n")
-f.write(",\n".join(indent + '"{}"'.format(tz["name"]) for tz in begin + list(timezones.values())))
+f.write(writeNames("TimeZone", [tz["name"] for tz in begin + list(timezones.values())]))
+f.close()
+
+# Write the country includes (enum + names + index). The time zones of each country are contiguous in CountryTimeZones, from the country's offset
+# to the next's (see Countries). Enumerators are prefixed, as some codes are common macros (e.g. IN and OUT in <windows.h>), names are the plain codes...
+begin = [ "Invalid" ]
+end = [ "_MAX" ]
+
+def countryEnum(c):
+    return "ISO_" + c
+
+f = open("etz-data/country-enum.inl", "w")
+f.write("enum class Country: uint16_t {\n")
+f.write(",\n".join(indent + c for c in begin + [countryEnum(c) for c in countries] + end))
 f.write("\n};\n")
 f.close()
+
+countryTimeZones = { c: [] for c in countries }
+for key, tz in timezones.items():
+    countryTimeZones[zoneCountries[key]].append("TimeZone::" + re.sub("[/-]", "_", tz["name"]))
+offsets = [0, 0]
+for c in countries:
+    offsets.append(offsets[-1] + len(countryTimeZones[c]))
+
+f = open("etz-data/country-names.inl", "w")
+f.write(writeNames("Country", begin + countries))
+f.write(writeArray("uint16_t", "CountryTimeZoneOffsets", offsets, 16))
+f.write(writeArray("TimeZone", "CountryTimeZones", [tz for c in countries for tz in countryTimeZones[c]]))
+f.write(writeArray("Country", "TimeZoneCountries", ["Country::Invalid"] + ["Country::" + countryEnum(zoneCountries[key]) for key in timezones]))
+f.close()
@@ -1,319 +1,384 @@
-static constexpr const char* AbbreviationNames[] {
-    "Invalid",
-    "AKST",
-    "CET",
-    "WMT",
-    "CAT",
-    "FJT",
-    "LINT",
-    "ACDT",
-    "PPMT",
-    "DAVT",
-    "KGT",
-    "ALMT",
-    "YAKT",
-    "STAT",
-    "VLAT",
-    "OMSST",
-    "CHUT",
-    "AKTST",
-    "URAT",
-    "OMST",
-    "DUSST",
-    "TAST",
-    "GST",
-    "--12",
-    "SBT",
-    "SAMST",
-    "AWST",
-    "DUST",
-    "HPT",
-    "EST",
-    "CST",
-    "ChST",
-    "VLAST",
-    "NZST",
-    "CVT",
-    "WITA",
-    "WGT",
-    "AEDT",
-    "AZOT",
-    "SMT",
-    "CMT",
-    "PYT",
-    "YEKST",
-    "PETST",
-    "IRST",
-    "PMMT",
-    "HKST",
-    "PLMT",
-    "MYT",
-    "TLT",
-    "EHDT",
-    "YDDT",
-    "ECT",
-    "PKST",
-    "AWDT",
-    "YPT",
-    "VET",
-    "AMST",
-    "SAKST",
-    "SRT",
-    "PMT",
-    "MWT",
-    "LHST",
-    "JMT",
-    "NRT",
-    "TRST",
-    "MART",
-    "WAST",
-    "DMT",
-    "APT",
-    "NPT",
-    "EPT",
-    "SVET",
-    "CPT",
-    "AFT",
-    "ISST",
-    "CAST",
-    "GALT",
-    "EDT",
-    "IDDT",
-    "MSK+4",
-    "MUST",
-    "MSD+1",
-    "FNT",
-    "IRKT",
-    "TBMT",
-    "GAMT",
-    "HOVT",
-    "QYZST",
-    "TJT",
-    "SHEST",
-    "KIZT",
-    "AEST",
-    "MSD+4",
-    "BDST",
-    "EET",
-    "KOST",
-    "IMT",
-    "PMDT",
-    "IDT",
-    "BORT",
-    "AQTT",
-    "ICT",
-    "EGT",
-    "HKWT",
-    "ANAT",
-    "CXT",
-    "SET",
-    "PST",
-    "UYT",
-    "SYOT",
-    "CLST",
-    "NUT",
-    "URAST",
-    "MPT",
-    "QYZT",
-    "ULAT",
-    "MUT",
-    "ACST",
-    "NZDT",
-    "PDT",
-    "KMT",
-    "EMT",
-    "EGST",
-    "UZT",
-    "URUT",
-    "CHAST",
-    "NFST",
-    "EWT",
-    "WFT",
-    "NDT",
-    "TRT",
-    "GDT",
-    "MVT",
-    "HMT",
-    "SVEST",
-    "WIT",
-    "RET",
-    "FRUT",
-    "WEMT",
-    "CHADT",
-    "FMT",
-    "BURT",
-    "MSK",
-    "WIB",
-    "PWT",
-    "ASHT",
-    "MDT",
-    "BTT",
-    "YWT",
-    "MAWT",
-    "NST",
-    "LMT",
-    "ANAST",
-    "CLT",
-    "SRET",
-    "YAKST",
-    "COT",
-    "HWT",
-    "PONT",
-    "NDDT",
-    "PMST",
-    "ANT",
-    "GILT",
-    "NCST",
-    "CHOST",
-    "NOVST",
-    "ART",
-    "RMT",
-    "UYST",
-    "CDT",
-    "KRAST",
-    "FKST",
-    "JAVT",
-    "TMT",
-    "ALMST",
-    "CCT",
-    "+10",
-    "MSK+3",
-    "ASHST",
-    "BMT",
-    "IOT",
-    "QMT",
-    "PPT",
-    "AMT",
-    "CVST",
-    "MALT",
-    "TOT",
-    "SHET",
-    "MSM",
-    "VUT",
-    "EDDT",
-    "KART",
-    "BRST",
-    "ADDT",
-    "HOVST",
-    "ADT",
-    "PET",
-    "HST",
-    "FFMT",
-    "WAKT",
-    "DDUT",
-    "YDT",
-    "MDST",
-    "AZST",
-    "ACWST",
-    "WGST",
-    "CDDT",
-    "MSK+1",
-    "MAGT",
-    "FNST",
-    "CGT",
-    "PNT",
-    "BRT",
-    "SST",
-    "ULAST",
-    "JST",
-    "ACT",
-    "GYT",
-    "CKHST",
-    "AWT",
-    "JDT",
-    "AKTT",
-    "ORAT",
-    "EEST",
-    "MSK+2",
-    "PETT",
-    "SDMT",
-    "+12",
-    "VUST",
-    "BDT",
-    "LST",
-    "IRKST",
-    "KGST",
-    "AKDT",
-    "NWT",
-    "VOLST",
-    "SAKT",
-    "SJMT",
-    "ACWDT",
-    "FRUST",
-    "NOVT",
-    "AST",
-    "GFT",
-    "MALST",
-    "GHST",
-    "CHOT",
-    "YST",
-    "TFT",
-    "ORAST",
-    "EAST",
-    "WST",
-    "ARST",
-    "NFDT",
-    "PHOT",
-    "EAT",
-    "SAMT",
-    "TAHT",
-    "PYST",
-    "PGT",
-    "TOST",
-    "TSAT",
-    "CEMT",
-    "GMT",
-    "KST",
-    "HKT",
-    "AHDT",
-    "AZOST",
-    "PDDT",
-    "NFT",
-    "COST",
-    "BST",
-    "IRDT",
-    "SAST",
-    "NZMT",
-    "MMT",
-    "TVT",
-    "MSD",
-    "MDDT",
-    "VOST",
-    "TKT",
-    "KRAT",
-    "+09",
-    "WEST",
-    "NCT",
-    "KUYST",
-    "GET",
-    "+11",
-    "CEST",
-    "KUYT",
-    "MSD+3",
-    "BORTST",
-    "FKT",
-    "PKT",
-    "TASST",
-    "AHST",
-    "CWT",
-    "GEST",
-    "BNT",
-    "FORT",
-    "SCT",
-    "PEST",
-    "MST",
-    "WAT",
-    "CKT",
-    "YEKT",
-    "HDT",
-    "EASST",
-    "WET",
-    "MAGST",
-    "AZT",
-    "IST",
-    "VOLT",
-    "LHDT",
-    "KDT",
-    "NMT",
-    "BOT"
+static constexpr char AbbreviationNames[] =
+    "Invalid\0"
+    "AKST\0"
+    "CET\0"
+    "WMT\0"
+    "CAT\0"
+    "FJT\0"
+    "LINT\0"
+    "ACDT\0"
+    "PPMT\0"
+    "DAVT\0"
+    "KGT\0"
+    "ALMT\0"
+    "YAKT\0"
+    "STAT\0"
+    "VLAT\0"
+    "OMSST\0"
+    "CHUT\0"
+    "AKTST\0"
+    "URAT\0"
+    "OMST\0"
+    "DUSST\0"
+    "TAST\0"
+    "GST\0"
+    "--12\0"
+    "SBT\0"
+    "SAMST\0"
+    "AWST\0"
+    "DUST\0"
+    "HPT\0"
+    "EST\0"
+    "CST\0"
+    "ChST\0"
+    "VLAST\0"
+    "NZST\0"
+    "CVT\0"
+    "WITA\0"
+    "WGT\0"
+    "AEDT\0"
+    "AZOT\0"
+    "SMT\0"
+    "CMT\0"
+    "PYT\0"
+    "YEKST\0"
+    "PETST\0"
+    "IRST\0"
+    "PMMT\0"
+    "HKST\0"
+    "PLMT\0"
+    "MYT\0"
+    "TLT\0"
+    "EHDT\0"
+    "YDDT\0"
+    "ECT\0"
+    "PKST\0"
+    "AWDT\0"
+    "YPT\0"
+    "VET\0"
+    "AMST\0"
+    "SAKST\0"
+    "SRT\0"
+    "PMT\0"
+    "MWT\0"
+    "LHST\0"
+    "JMT\0"
+    "NRT\0"
+    "TRST\0"
+    "MART\0"
+    "WAST\0"
+    "DMT\0"
+    "APT\0"
+    "NPT\0"
+    "EPT\0"
+    "SVET\0"
+    "CPT\0"
+    "AFT\0"
+    "ISST\0"
+    "CAST\0"
+    "GALT\0"
+    "EDT\0"
+    "IDDT\0"
+    "MSK+4\0"
+    "MUST\0"
+    "MSD+1\0"
+    "FNT\0"
+    "IRKT\0"
+    "TBMT\0"
+    "GAMT\0"
+    "HOVT\0"
+    "QYZST\0"
+    "TJT\0"
+    "SHEST\0"
+    "KIZT\0"
+    "AEST\0"
+    "MSD+4\0"
+    "BDST\0"
+    "EET\0"
+    "KOST\0"
+    "IMT\0"
+    "PMDT\0"
+    "IDT\0"
+    "BORT\0"
+    "AQTT\0"
+    "ICT\0"
+    "EGT\0"
+    "HKWT\0"
+    "ANAT\0"
+    "CXT\0"
+    "SET\0"
+    "PST\0"
+    "UYT\0"
+    "SYOT\0"
+    "CLST\0"
+    "NUT\0"
+    "URAST\0"
+    "MPT\0"
+    "QYZT\0"
+    "ULAT\0"
+    "MUT\0"
+    "ACST\0"
+    "NZDT\0"
+    "PDT\0"
+    "KMT\0"
+    "EMT\0"
+    "EGST\0"
+    "UZT\0"
+    "URUT\0"
+    "CHAST\0"
+    "NFST\0"
+    "EWT\0"
+    "WFT\0"
+    "NDT\0"
+    "TRT\0"
+    "GDT\0"
+    "MVT\0"
+    "HMT\0"
+    "SVEST\0"
+    "WIT\0"
+    "RET\0"
+    "FRUT\0"
+    "WEMT\0"
+    "CHADT\0"
+    "FMT\0"
+    "BURT\0"
+    "MSK\0"
+    "WIB\0"
+    "PWT\0"
+    "ASHT\0"
+    "MDT\0"
+    "BTT\0"
+    "YWT\0"
+    "MAWT\0"
+    "NST\0"
+    "LMT\0"
+    "ANAST\0"
+    "CLT\0"
+    "SRET\0"
+    "YAKST\0"
+    "COT\0"
+    "HWT\0"
+    "PONT\0"
+    "NDDT\0"
+    "PMST\0"
+    "ANT\0"
+    "GILT\0"
+    "NCST\0"
+    "CHOST\0"
+    "NOVST\0"
+    "ART\0"
+    "RMT\0"
+    "UYST\0"
+    "CDT\0"
+    "KRAST\0"
+    "FKST\0"
+    "JAVT\0"
+    "TMT\0"
+    "ALMST\0"
+    "CCT\0"
+    "+10\0"
+    "MSK+3\0"
+    "ASHST\0"
+    "BMT\0"
+    "IOT\0"
+    "QMT\0"
+    "PPT\0"
+    "AMT\0"
+    "CVST\0"
+    "MALT\0"
+    "TOT\0"
+    "SHET\0"
+    "MSM\0"
+    "VUT\0"
+    "EDDT\0"
+    "KART\0"
+    "BRST\0"
+    "ADDT\0"
+    "HOVST\0"
+    "ADT\0"
+    "PET\0"
+    "HST\0"
+    "FFMT\0"
+    "WAKT\0"
+    "DDUT\0"
+    "YDT\0"
+    "MDST\0"
+    "AZST\0"
+    "ACWST\0"
+    "WGST\0"
+    "CDDT\0"
+    "MSK+1\0"
+    "MAGT\0"
+    "FNST\0"
+    "CGT\0"
+    "PNT\0"
+    "BRT\0"
+    "SST\0"
+    "ULAST\0"
+    "JST\0"
+    "ACT\0"
+    "GYT\0"
+    "CKHST\0"
+    "AWT\0"
+    "JDT\0"
+    "AKTT\0"
+    "ORAT\0"
+    "EEST\0"
+    "MSK+2\0"
+    "PETT\0"
+    "SDMT\0"
+    "+12\0"
+    "VUST\0"
+    "BDT\0"
+    "LST\0"
+    "IRKST\0"
+    "KGST\0"
+    "AKDT\0"
+    "NWT\0"
+    "VOLST\0"
+    "SAKT\0"
+    "SJMT\0"
+    "ACWDT\0"
+    "FRUST\0"
+    "NOVT\0"
+    "AST\0"
+    "GFT\0"
+    "MALST\0"
+    "GHST\0"
+    "CHOT\0"
+    "YST\0"
+    "TFT\0"
+    "ORAST\0"
+    "EAST\0"
+    "WST\0"
+    "ARST\0"
+    "NFDT\0"
+    "PHOT\0"
+    "EAT\0"
+    "SAMT\0"
+    "TAHT\0"
+    "PYST\0"
+    "PGT\0"
+    "TOST\0"
+    "TSAT\0"
+    "CEMT\0"
+    "GMT\0"
+    "KST\0"
+    "HKT\0"
+    "AHDT\0"
+    "AZOST\0"
+    "PDDT\0"
+    "NFT\0"
+    "COST\0"
+    "BST\0"
+    "IRDT\0"
+    "SAST\0"
+    "NZMT\0"
+    "MMT\0"
+    "TVT\0"
+    "MSD\0"
+    "MDDT\0"
+    "VOST\0"
+    "TKT\0"
+    "KRAT\0"
+    "+09\0"
+    "WEST\0"
+    "NCT\0"
+    "KUYST\0"
+    "GET\0"
+    "+11\0"
+    "CEST\0"
+    "KUYT\0"
+    "MSD+3\0"
+    "BORTST\0"
+    "FKT\0"
+    "PKT\0"
+    "TASST\0"
+    "AHST\0"
+    "CWT\0"
+    "GEST\0"
+    "BNT\0"
+    "FORT\0"
+    "SCT\0"
+    "PEST\0"
+    "MST\0"
+    "WAT\0"
+    "CKT\0"
+    "YEKT\0"
+    "HDT\0"
+    "EASST\0"
+    "WET\0"
+    "MAGST\0"
+    "AZT\0"
+    "IST\0"
+    "VOLT\0"
+    "LHDT\0"
+    "KDT\0"
+    "NMT\0"
+    "BOT\0";
+static constexpr uint16_t AbbreviationNameOffsets[] = {
+    0, 8, 13, 17, 21, 25, 29, 34, 39, 44, 49, 53, 58, 63, 68, 73,
+    79, 84, 90, 95, 100, 106, 111, 115, 120, 124, 130, 135, 140, 144, 148, 152,
+    157, 163, 168, 172, 177, 181, 186, 191, 195, 199, 203, 209, 215, 220, 225, 230,
+    235, 239, 243, 248, 253, 257, 262, 267, 271, 275, 280, 286, 290, 294, 298, 303,
+    307, 311, 316, 321, 326, 330, 334, 338, 342, 347, 351, 355, 360, 365, 370, 374,
+    379, 385, 390, 396, 400, 405, 410, 415, 420, 426, 430, 436, 441, 446, 452, 457,
+    461, 466, 470, 475, 479, 484, 489, 493, 497, 502, 507, 511, 515, 519, 523, 528,
+    533, 537, 543, 547, 552, 557, 561, 566, 571, 575, 579, 583, 588, 592, 597, 603,
+    608, 612, 616, 620, 624, 628, 632, 636, 642, 646, 650, 655, 660, 666, 670, 675,
+    679, 683, 687, 692, 696, 700, 704, 709, 713, 717, 723, 727, 732, 738, 742, 746,
+    751, 756, 761, 765, 770, 775, 781, 787, 791, 795, 800, 804, 810, 815, 820, 824,
+    830, 834, 838, 844, 850, 854, 858, 862, 866, 870, 875, 880, 884, 889, 893, 897,
+    902, 907, 912, 917, 923, 927, 931, 935, 940, 945, 950, 954, 959, 964, 970, 975,
+    980, 986, 991, 996, 1000, 1004, 1008, 1012, 1018, 1022, 1026, 1030, 1036, 1040, 1044, 1049,
+    1054, 1059, 1065, 1070, 1075, 1079, 1084, 1088, 1092, 1098, 1103, 1108, 1112, 1118, 1123, 1128,
+    1134, 1140, 1145, 1149, 1153, 1159, 1164, 1169, 1173, 1177, 1183, 1188, 1192, 1197, 1202, 1207,
+    1211, 1216, 1221, 1226, 1230, 1235, 1240, 1245, 1249, 1253, 1257, 1262, 1268, 1273, 1277, 1282,
+    1286, 1291, 1296, 1301, 1305, 1309, 1313, 1318, 1323, 1327, 1332, 1336, 1341, 1345, 1351, 1355,
+    1359, 1364, 1369, 1375, 1382, 1386, 1390, 1396, 1401, 1405, 1410, 1414, 1419, 1423, 1428, 1432,
+    1436, 1440, 1445, 1449, 1455, 1459, 1465, 1469, 1473, 1478, 1483, 1487, 1491, 1495
+};
+static constexpr int16_t AbbreviationHashSeeds[] = {
+    1, 1, 5, 2, -317, 0, -315, -312, 0, 0, -309, -296, 1, 1, 3, 1,
+    -294, 0, 1, 1, 0, -293, 0, 0, 0, 1, -291, 3, -288, 0, 0, 0,
+    0, 2, 0, -286, 0, 0, -277, -275, -274, -272, 1, 4, 0, 0, 0, -269,
+    -265, -262, 0, 0, 2, 0, 8, 1, -258, -256, 3, -254, 0, -253, 1, -252,
+    0, 3, 0, 2, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, -251, 9,
+    -246, 5, 0, 0, 0, 0, 1, -245, -244, -243, -235, 0, 0, -233, 0, 0,
+    2, -232, 0, 2, -230, 0, 0, -228, 3, -221, 1, -219, -212, 0, 0, 0,
+    6, 1, 0, -209, -208, -205, -204, 1, -202, -200, 0, -199, 0, 9, 0, 8,
+    1, -194, 0, 0, 2, 0, -193, -189, 2, 0, -188, -186, -181, 0, -178, -176,
+    4, 0, -175, 0, 0, 0, 1, -173, 0, 6, 0, -172, -170, -168, 10, -166,
+    -165, 5, -162, -161, 0, -157, 0, -151, -150, 0, -149, 0, -145, 0, -140, 0,
+    3, 0, 0, 7, -138, 0, 3, 0, -137, 0, 0, -136, -134, -132, 1, -124,
+    0, 1, 0, -123, 3, 1, 0, 0, -122, 2, 0, -115, 8, 2, -114, 0,
+    0, -108, 0, -107, -105, -103, -101, 0, 0, 0, 0, 0, -97, -96, 0, -93,
+    7, 10, 1, 2, -92, 6, 2, 0, 0, -91, 0, 0, 0, -90, 0, 1,
+    -89, -78, 0, 1, 3, 0, 0, 0, -74, 1, -73, 0, -69, 3, -67, -63,
+    2, 0, 0, 4, 2, 0, -57, 0, 0, -56, 0, -55, 0, -54, -53, 0,
+    -51, 0, -49, -45, 0, 1, -44, 8, -42, -31, 0, -29, 0, 3, -26, 0,
+    -24, 7, 0, 4, -21, 0, 12, -20, 4, 3, 0, 0, 1, -18, 2, -16,
+    -15, -10, 0, -7, -2, 0, 0, 15, 1, 0, 2, 3, 0
+};
+static constexpr uint16_t AbbreviationHashSlots[] = {
+    134, 47, 20, 70, 29, 119, 251, 27, 245, 225, 44, 198, 128, 118, 288, 200,
+    61, 237, 263, 88, 277, 25, 159, 150, 33, 135, 273, 69, 231, 247, 63, 162,
+    213, 65, 208, 209, 253, 165, 54, 238, 120, 48, 123, 194, 96, 9, 157, 290,
+    195, 111, 297, 81, 105, 60, 89, 229, 147, 43, 294, 21, 11, 94, 296, 226,
+    266, 202, 259, 267, 206, 258, 100, 269, 124, 175, 287, 114, 139, 274, 262, 132,
+    15, 104, 190, 310, 45, 149, 97, 4, 217, 207, 66, 178, 268, 50, 272, 121,
+    278, 189, 279, 51, 314, 232, 28, 166, 78, 53, 196, 210, 257, 286, 233, 281,
+    156, 179, 49, 249, 137, 71, 106, 187, 289, 184, 170, 22, 77, 305, 143, 168,
+    308, 246, 144, 117, 32, 68, 240, 309, 158, 261, 311, 280, 164, 163, 239, 86,
+    87, 101, 192, 191, 142, 250, 79, 174, 133, 126, 211, 131, 5, 6, 255, 299,
+    72, 223, 75, 293, 201, 58, 52, 224, 185, 42, 108, 248, 80, 285, 102, 205,
+    83, 182, 313, 152, 243, 252, 73, 59, 235, 180, 23, 122, 38, 76, 55, 151,
+    160, 303, 74, 230, 127, 141, 82, 260, 40, 30, 284, 173, 99, 282, 155, 107,
+    197, 244, 222, 110, 125, 85, 221, 270, 57, 203, 19, 64, 295, 315, 283, 301,
+    316, 215, 298, 34, 62, 129, 91, 264, 241, 41, 13, 10, 172, 0, 300, 56,
+    26, 14, 271, 98, 24, 109, 140, 307, 136, 176, 188, 90, 292, 67, 181, 306,
+    3, 291, 276, 31, 153, 216, 130, 146, 2, 8, 16, 138, 95, 1, 46, 154,
+    36, 169, 177, 214, 116, 204, 220, 37, 183, 275, 254, 18, 145, 148, 112, 186,
+    193, 312, 12, 113, 17, 115, 234, 302, 93, 219, 84, 218, 256, 103, 228, 35,
+    92, 199, 236, 39, 227, 265, 161, 167, 212, 7, 171, 304, 242
 };
@@ -0,0 +1,253 @@
+enum class Country: uint16_t {
+    Invalid,
+    ISO_AD,
+    ISO_AE,
+    ISO_AF,
+    ISO_AG,
+    ISO_AI,
+    ISO_AL,
+    ISO_AM,
+    ISO_AO,
+    ISO_AQ,
+    ISO_AR,
+    ISO_AS,
+    ISO_AT,
+    ISO_AU,
+    ISO_AW,
+    ISO_AX,
+    ISO_AZ,
+    ISO_BA,
+    ISO_BB,
+    ISO_BD,
+    ISO_BE,
+    ISO_BF,
+    ISO_BG,
+    ISO_BH,
+    ISO_BI,
+    ISO_BJ,
+    ISO_BL,
+    ISO_BM,
+    ISO_BN,
+    ISO_BO,
+    ISO_BQ,
+    ISO_BR,
+    ISO_BS,
+    ISO_BT,
+    ISO_BV,
+    ISO_BW,
+    ISO_BY,
+    ISO_BZ,
+    ISO_CA,
+    ISO_CC,
+    ISO_CD,
+    ISO_CF,
+    ISO_CG,
+    ISO_CH,
+    ISO_CI,
+    ISO_CK,
+    ISO_CL,
+    ISO_CM,
+    ISO_CN,
+    ISO_CO,
+    ISO_CR,
+    ISO_CU,
+    ISO_CV,
+    ISO_CW,
+    ISO_CX,
+    ISO_CY,
+    ISO_CZ,
+    ISO_DE,
+    ISO_DJ,
+    ISO_DK,
+    ISO_DM,
+    ISO_DO,
+    ISO_DZ,
+    ISO_EC,
+    ISO_EE,
+    ISO_EG,
+    ISO_EH,
+    ISO_ER,
+    ISO_ES,
+    ISO_ET,
+    ISO_FI,
+    ISO_FJ,
+    ISO_FK,
+    ISO_FM,
+    ISO_FO,
+    ISO_FR,
+    ISO_GA,
+    ISO_GB,
+    ISO_GD,
+    ISO_GE,
+    ISO_GF,
+    ISO_GG,
+    ISO_GH,
+    ISO_GI,
+    ISO_GL,
+    ISO_GM,
+    ISO_GN,
+    ISO_GP,
+    ISO_GQ,
+    ISO_GR,
+    ISO_GS,
+    ISO_GT,
+    ISO_GU,
+    ISO_GW,
+    ISO_GY,
+    ISO_HK,
+    ISO_HM,
+    ISO_HN,
+    ISO_HR,
+    ISO_HT,
+    ISO_HU,
+    ISO_ID,
+    ISO_IE,
+    ISO_IL,
+    ISO_IM,
+    ISO_IN,
+    ISO_IO,
+    ISO_IQ,
+    ISO_IR,
+    ISO_IS,
+    ISO_IT,
+    ISO_JE,
+    ISO_JM,
+    ISO_JO,
+    ISO_JP,
+    ISO_KE,
+    ISO_KG,
+    ISO_KH,
+    ISO_KI,
+    ISO_KM,
+    ISO_KN,
+    ISO_KP,
+    ISO_KR,
+    ISO_KW,
+    ISO_KY,
+    ISO_KZ,
+    ISO_LA,
+    ISO_LB,
+    ISO_LC,
+    ISO_LI,
+    ISO_LK,
+    ISO_LR,
+    ISO_LS,
+    ISO_LT,
+    ISO_LU,
+    ISO_LV,
+    ISO_LY,
+    ISO_MA,
+    ISO_MC,
+    ISO_MD,
+    ISO_ME,
+    ISO_MF,
+    ISO_MG,
+    ISO_MH,
+    ISO_MK,
+    ISO_ML,
+    ISO_MM,
+    ISO_MN,
+    ISO_MO,
+    ISO_MP,
+    ISO_MQ,
+    ISO_MR,
+    ISO_MS,
+    ISO_MT,
+    ISO_MU,
+    ISO_MV,
+    ISO_MW,
+    ISO_MX,
+    ISO_MY,
+    ISO_MZ,
+    ISO_NA,
+    ISO_NC,
+    ISO_NE,
+    ISO_NF,
+    ISO_NG,
+    ISO_NI,
+    ISO_NL,
+    ISO_NO,
+    ISO_NP,
+    ISO_NR,
+    ISO_NU,
+    ISO_NZ,
+    ISO_OM,
+    ISO_PA,
+    ISO_PE,
+    ISO_PF,
+    ISO_PG,
+    ISO_PH,
+    ISO_PK,
+    ISO_PL,
+    ISO_PM,
+    ISO_PN,
+    ISO_PR,
+    ISO_PS,
+    ISO_PT,
+    ISO_PW,
+    ISO_PY,
+    ISO_QA,
+    ISO_RE,
+    ISO_RO,
+    ISO_RS,
+    ISO_RU,
+    ISO_RW,
+    ISO_SA,
+    ISO_SB,
+    ISO_SC,
+    ISO_SD,
+    ISO_SE,
+    ISO_SG,
+    ISO_SH,
+    ISO_SI,
+    ISO_SJ,
+    ISO_SK,
+    ISO_SL,
+    ISO_SM,
+    ISO_SN,
+    ISO_SO,
+    ISO_SR,
+    ISO_SS,
+    ISO_ST,
+    ISO_SV,
+    ISO_SX,
+    ISO_SY,
+    ISO_SZ,
+    ISO_TC,
+    ISO_TD,
+    ISO_TF,
+    ISO_TG,
+    ISO_TH,
+    ISO_TJ,
+    ISO_TK,
+    ISO_TL,
+    ISO_TM,
+    ISO_TN,
+    ISO_TO,
+    ISO_TR,
+    ISO_TT,
+    ISO_TV,
+    ISO_TW,
+    ISO_TZ,
+    ISO_UA,
+    ISO_UG,
+    ISO_UM,
+    ISO_US,
+    ISO_UY,
+    ISO_UZ,
+    ISO_VA,
+    ISO_VC,
+    ISO_VE,
+    ISO_VG,
+    ISO_VI,
+    ISO_VN,
+    ISO_VU,
+    ISO_WF,
+    ISO_WS,
+    ISO_YE,
+    ISO_YT,
+    ISO_ZA,
+    ISO_ZM,
+    ISO_ZW,
+    _MAX
+};
@@ -0,0 +1,1178 @@
+static constexpr char CountryNames[] =
+    "Invalid\0"
+    "AD\0"
+    "AE\0"
+    "AF\0"
+    "AG\0"
+    "AI\0"
+    "AL\0"
+    "AM\0"
+    "AO\0"
+    "AQ\0"
+    "AR\0"
+    "AS\0"
+    "AT\0"
+    "AU\0"
+    "AW\0"
+    "AX\0"
+    "AZ\0"
+    "BA\0"
+    "BB\0"
+    "BD\0"
+    "BE\0"
+    "BF\0"
+    "BG\0"
+    "BH\0"
+    "BI\0"
+    "BJ\0"
+    "BL\0"
+    "BM\0"
+    "BN\0"
+    "BO\0"
+    "BQ\0"
+    "BR\0"
+    "BS\0"
+    "BT\0"
+    "BV\0"
+    "BW\0"
+    "BY\0"
+    "BZ\0"
+    "CA\0"
+    "CC\0"
+    "CD\0"
+    "CF\0"
+    "CG\0"
+    "CH\0"
+    "CI\0"
+    "CK\0"
+    "CL\0"
+    "CM\0"
+    "CN\0"
+    "CO\0"
+    "CR\0"
+    "CU\0"
+    "CV\0"
+    "CW\0"
+    "CX\0"
+    "CY\0"
+    "CZ\0"
+    "DE\0"
+    "DJ\0"
+    "DK\0"
+    "DM\0"
+    "DO\0"
+    "DZ\0"
+    "EC\0"
+    "EE\0"
+    "EG\0"
+    "EH\0"
+    "ER\0"
+    "ES\0"
+    "ET\0"
+    "FI\0"
+    "FJ\0"
+    "FK\0"
+    "FM\0"
+    "FO\0"
+    "FR\0"
+    "GA\0"
+    "GB\0"
+    "GD\0"
+    "GE\0"
+    "GF\0"
+    "GG\0"
+    "GH\0"
+    "GI\0"
+    "GL\0"
+    "GM\0"
+    "GN\0"
+    "GP\0"
+    "GQ\0"
+    "GR\0"
+    "GS\0"
+    "GT\0"
+    "GU\0"
+    "GW\0"
+    "GY\0"
+    "HK\0"
+    "HM\0"
+    "HN\0"
+    "HR\0"
+    "HT\0"
+    "HU\0"
+    "ID\0"
+    "IE\0"
+    "IL\0"
+    "IM\0"
+    "IN\0"
+    "IO\0"
+    "IQ\0"
+    "IR\0"
+    "IS\0"
+    "IT\0"
+    "JE\0"
+    "JM\0"
+    "JO\0"
+    "JP\0"
+    "KE\0"
+    "KG\0"
+    "KH\0"
+    "KI\0"
+    "KM\0"
+    "KN\0"
+    "KP\0"
+    "KR\0"
+    "KW\0"
+    "KY\0"
+    "KZ\0"
+    "LA\0"
+    "LB\0"
+    "LC\0"
+    "LI\0"
+    "LK\0"
+    "LR\0"
+    "LS\0"
+    "LT\0"
+    "LU\0"
+    "LV\0"
+    "LY\0"
+    "MA\0"
+    "MC\0"
+    "MD\0"
+    "ME\0"
+    "MF\0"
+    "MG\0"
+    "MH\0"
+    "MK\0"
+    "ML\0"
+    "MM\0"
+    "MN\0"
+    "MO\0"
+    "MP\0"
+    "MQ\0"
+    "MR\0"
+    "MS\0"
+    "MT\0"
+    "MU\0"
+    "MV\0"
+    "MW\0"
+    "MX\0"
+    "MY\0"
+    "MZ\0"
+    "NA\0"
+    "NC\0"
+    "NE\0"
+    "NF\0"
+    "NG\0"
+    "NI\0"
+    "NL\0"
+    "NO\0"
+    "NP\0"
+    "NR\0"
+    "NU\0"
+    "NZ\0"
+    "OM\0"
+    "PA\0"
+    "PE\0"
+    "PF\0"
+    "PG\0"
+    "PH\0"
+    "PK\0"
+    "PL\0"
+    "PM\0"
+    "PN\0"
+    "PR\0"
+    "PS\0"
+    "PT\0"
+    "PW\0"
+    "PY\0"
+    "QA\0"
+    "RE\0"
+    "RO\0"
+    "RS\0"
+    "RU\0"
+    "RW\0"
+    "SA\0"
+    "SB\0"
+    "SC\0"
+    "SD\0"
+    "SE\0"
+    "SG\0"
+    "SH\0"
+    "SI\0"
+    "SJ\0"
+    "SK\0"
+    "SL\0"
+    "SM\0"
+    "SN\0"
+    "SO\0"
+    "SR\0"
+    "SS\0"
+    "ST\0"
+    "SV\0"
+    "SX\0"
+    "SY\0"
+    "SZ\0"
+    "TC\0"
+    "TD\0"
+    "TF\0"
+    "TG\0"
+    "TH\0"
+    "TJ\0"
+    "TK\0"
+    "TL\0"
+    "TM\0"
+    "TN\0"
+    "TO\0"
+    "TR\0"
+    "TT\0"
+    "TV\0"
+    "TW\0"
+    "TZ\0"
+    "UA\0"
+    "UG\0"
+    "UM\0"
+    "US\0"
+    "UY\0"
+    "UZ\0"
+    "VA\0"
+    "VC\0"
+    "VE\0"
+    "VG\0"
+    "VI\0"
+    "VN\0"
+    "VU\0"
+    "WF\0"
+    "WS\0"
+    "YE\0"
+    "YT\0"
+    "ZA\0"
+    "ZM\0"
+    "ZW\0";
+static constexpr uint16_t CountryNameOffsets[] = {
+    0, 8, 11, 14, 17, 20, 23, 26, 29, 32, 35, 38, 41, 44, 47, 50,
+    53, 56, 59, 62, 65, 68, 71, 74, 77, 80, 83, 86, 89, 92, 95, 98,
+    101, 104, 107, 110, 113, 116, 119, 122, 125, 128, 131, 134, 137, 140, 143, 146,
+    149, 152, 155, 158, 161, 164, 167, 170, 173, 176, 179, 182, 185, 188, 191, 194,
+    197, 200, 203, 206, 209, 212, 215, 218, 221, 224, 227, 230, 233, 236, 239, 242,
+    245, 248, 251, 254, 257, 260, 263, 266, 269, 272, 275, 278, 281, 284, 287, 290,
+    293, 296, 299, 302, 305, 308, 311, 314, 317, 320, 323, 326, 329, 332, 335, 338,
+    341, 344, 347, 350, 353, 356, 359, 362, 365, 368, 371, 374, 377, 380, 383, 386,
+    389, 392, 395, 398, 401, 404, 407, 410, 413, 416, 419, 422, 425, 428, 431, 434,
+    437, 440, 443, 446, 449, 452, 455, 458, 461, 464, 467, 470, 473, 476, 479, 482,
+    485, 488, 491, 494, 497, 500, 503, 506, 509, 512, 515, 518, 521, 524, 527, 530,
+    533, 536, 539, 542, 545, 548, 551, 554, 557, 560, 563, 566, 569, 572, 575, 578,
+    581, 584, 587, 590, 593, 596, 599, 602, 605, 608, 611, 614, 617, 620, 623, 626,
+    629, 632, 635, 638, 641, 644, 647, 650, 653, 656, 659, 662, 665, 668, 671, 674,
+    677, 680, 683, 686, 689, 692, 695, 698, 701, 704, 707, 710, 713, 716, 719, 722,
+    725, 728, 731, 734, 737, 740, 743, 746, 749, 752, 755
+};
+static constexpr int16_t CountryHashSeeds[] = {
+    0, 0, 0, 0, 0, 1, -249, 15, 1, -239, 0, 0, 0, 0, 0, -238,
+    0, 13, 0, 7, 1, -237, 0, 0, 0, 0, 0, 0, 13, -228, -226, 6,
+    -216, -214, 0, 0, 0, 0, 0, 0, 3, 22, 33, 1, 1, 7, 0, 0,
+    0, 0, 0, -203, 1, 4, -190, 43, 52, 0, 0, 0, 0, 0, 0, -189,
+    1, 52, 0, 28, 13, -188, 0, 0, 0, 0, 0, -178, 23, 51, 0, 25,
+    -177, -169, 0, 0, 0, 0, 0, -166, 2, 42, -156, 36, 12, 0, 0, 0,
+    0, 0, 0, -155, 34, -153, 66, -143, -142, 0, 0, 0, 0, 0, 0, 13,
+    41, -134, 0, 54, -132, -131, 0, 0, 0, 0, -119, -118, 98, 0, 65, 8,
+    -107, -96, 0, 0, 0, 0, -95, 41, 19, -94, 2, 1, -86, -85, 0, 0,
+    0, 0, 0, 68, -84, 0, 1, 1, -83, 0, 0, 0, 0, 0, 0, 0,
+    -73, -71, 77, 3, 80, 0, 0, 0, 0, -70, 0, 4, 9, -60, 65, 5,
+    -59, 0, 0, 0, 0, 0, 127, 11, 18, 0, 10, 1, -58, 0, 0, 0,
+    0, 0, 69, 69, 105, 0, 6, 111, -48, 0, 0, 0, 0, 0, -47, 104,
+    0, 0, 106, 118, -36, 0, 0, 0, 0, 0, 0, -25, 102, -24, 9, 90,
+    0, 0, 0, 0, 0, 0, -13, -12, 110, 0, 25, -11, -10, 0, 0, 0,
+    0, 0, 110, 125, -1, 0, 8, 7, 0, 0
+};
+static constexpr uint16_t CountryHashSlots[] = {
+    84, 119, 241, 183, 168, 190, 147, 217, 132, 66, 33, 234, 40, 99, 14, 88,
+    218, 139, 0, 102, 30, 192, 18, 166, 75, 34, 212, 225, 216, 173, 219, 157,
+    163, 100, 188, 20, 27, 185, 180, 127, 233, 58, 148, 199, 144, 152, 43, 22,
+    194, 10, 198, 162, 208, 11, 4, 61, 201, 17, 67, 81, 136, 242, 175, 184,
+    37, 154, 5, 103, 204, 187, 79, 247, 205, 193, 215, 15, 150, 249, 186, 125,
+    68, 73, 29, 203, 63, 24, 101, 229, 170, 70, 116, 155, 107, 76, 96, 64,
+    31, 131, 177, 224, 232, 72, 140, 143, 145, 200, 117, 196, 106, 50, 181, 222,
+    122, 221, 9, 134, 245, 38, 95, 160, 243, 227, 235, 220, 158, 78, 171, 109,
+    128, 57, 65, 120, 16, 85, 104, 108, 214, 240, 42, 87, 230, 35, 156, 189,
+    39, 161, 113, 133, 89, 202, 115, 56, 195, 126, 172, 167, 82, 210, 98, 238,
+    164, 1, 191, 54, 153, 45, 94, 165, 19, 83, 246, 36, 137, 123, 182, 197,
+    32, 44, 8, 53, 51, 176, 213, 121, 209, 236, 52, 21, 49, 80, 60, 231,
+    111, 174, 141, 149, 12, 237, 6, 211, 142, 46, 47, 91, 105, 178, 244, 151,
+    135, 228, 110, 138, 2, 26, 129, 3, 130, 239, 93, 169, 118, 13, 124, 112,
+    25, 77, 41, 206, 69, 62, 223, 90, 59, 92, 114, 74, 28, 97, 23, 48,
+    159, 146, 179, 55, 248, 207, 226, 71, 86, 7
+};
+static constexpr uint16_t CountryTimeZoneOffsets[] = {
+    0, 0, 1, 2, 3, 4, 5, 6, 7, 8, 18, 30, 31, 32, 45, 46,
+    47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62,
+    78, 79, 80, 80, 81, 82, 83, 111, 112, 114, 115, 116, 117, 118, 119, 122,
+    123, 125, 126, 127, 128, 129, 130, 131, 133, 134, 136, 137, 138, 139, 140, 141,
+    143, 144, 145, 146, 147, 150, 151, 152, 153, 154, 157, 158, 159, 160, 161, 162,
+    163, 164, 165, 166, 167, 171, 172, 173, 174, 175, 176, 177, 178, 179, 180, 181,
+    182, 182, 183, 184, 185, 186, 190, 191, 192, 193, 194, 195, 196, 197, 198, 199,
+    200, 201, 202, 203, 204, 205, 206, 209, 210, 211, 212, 213, 214, 215, 222, 223,
+    224, 225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239,
+    241, 242, 243, 244, 247, 248, 249, 250, 251, 252, 253, 254, 255, 256, 267, 269,
+    270, 271, 272, 273, 274, 275, 276, 277, 278, 279, 280, 281, 283, 284, 285, 286,
+    289, 291, 292, 293, 294, 295, 296, 297, 299, 302, 303, 304, 305, 306, 307, 308,
+    334, 335, 336, 337, 338, 339, 340, 341, 342, 343, 344, 345, 346, 347, 348, 349,
+    350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 360, 361, 362, 363, 364, 365,
+    366, 367, 368, 369, 370, 371, 372, 376, 377, 379, 408, 409, 411, 412, 413, 414,
+    415, 416, 417, 418, 419, 420, 421, 422, 423, 424, 425
+};
+static constexpr TimeZone CountryTimeZones[] = {
+    TimeZone::Europe_Andorra,
+    TimeZone::Asia_Dubai,
+    TimeZone::Asia_Kabul,
+    TimeZone::America_Antigua,
+    TimeZone::America_Anguilla,
+    TimeZone::Europe_Tirane,
+    TimeZone::Asia_Yerevan,
+    TimeZone::Africa_Luanda,
+    TimeZone::Antarctica_McMurdo,
+    TimeZone::Antarctica_Casey,
+    TimeZone::Antarctica_Davis,
+    TimeZone::Antarctica_DumontDUrville,
+    TimeZone::Antarctica_Mawson,
+    TimeZone::Antarctica_Palmer,
+    TimeZone::Antarctica_Rothera,
+    TimeZone::Antarctica_Syowa,
+    TimeZone::Antarctica_Troll,
+    TimeZone::Antarctica_Vostok,
+    TimeZone::America_Argentina_Buenos_Aires,
+    TimeZone::America_Argentina_Cordoba,
+    TimeZone::America_Argentina_Salta,
+    TimeZone::America_Argentina_Jujuy,
+    TimeZone::America_Argentina_Tucuman,
+    TimeZone::America_Argentina_Catamarca,
+    TimeZone::America_Argentina_La_Rioja,
+    TimeZone::America_Argentina_San_Juan,
+    TimeZone::America_Argentina_Mendoza,
+    TimeZone::America_Argentina_San_Luis,
+    TimeZone::America_Argentina_Rio_Gallegos,
+    TimeZone::America_Argentina_Ushuaia,
+    TimeZone::Pacific_Pago_Pago,
+    TimeZone::Europe_Vienna,
+    TimeZone::Australia_Lord_Howe,
+    TimeZone::Antarctica_Macquarie,
+    TimeZone::Australia_Hobart,
+    TimeZone::Australia_Currie,
+    TimeZone::Australia_Melbourne,
+    TimeZone::Australia_Sydney,
+    TimeZone::Australia_Broken_Hill,
+    TimeZone::Australia_Brisbane,
+    TimeZone::Australia_Lindeman,
+    TimeZone::Australia_Adelaide,
+    TimeZone::Australia_Darwin,
+    TimeZone::Australia_Perth,
+    TimeZone::Australia_Eucla,
+    TimeZone::America_Aruba,
+    TimeZone::Europe_Mariehamn,
+    TimeZone::Asia_Baku,
+    TimeZone::Europe_Sarajevo,
+    TimeZone::America_Barbados,
+    TimeZone::Asia_Dhaka,
+    TimeZone::Europe_Brussels,
+    TimeZone::Africa_Ouagadougou,
+    TimeZone::Europe_Sofia,
+    TimeZone::Asia_Bahrain,
+    TimeZone::Africa_Bujumbura,
+    TimeZone::Africa_Porto_Novo,
+    TimeZone::America_St_Barthelemy,
+    TimeZone::Atlantic_Bermuda,
+    TimeZone::Asia_Brunei,
+    TimeZone::America_La_Paz,
+    TimeZone::America_Kralendijk,
+    TimeZone::America_Noronha,
+    TimeZone::America_Belem,
+    TimeZone::America_Fortaleza,
+    TimeZone::America_Recife,
+    TimeZone::America_Araguaina,
+    TimeZone::America_Maceio,
+    TimeZone::America_Bahia,
+    TimeZone::America_Sao_Paulo,
+    TimeZone::America_Campo_Grande,
+    TimeZone::America_Cuiaba,
+    TimeZone::America_Santarem,
+    TimeZone::America_Porto_Velho,
+    TimeZone::America_Boa_Vista,
+    TimeZone::America_Manaus,
+    TimeZone::America_Eirunepe,
+    TimeZone::America_Rio_Branco,
+    TimeZone::America_Nassau,
+    TimeZone::Asia_Thimphu,
+    TimeZone::Africa_Gaborone,
+    TimeZone::Europe_Minsk,
+    TimeZone::America_Belize,
+    TimeZone::America_St_Johns,
+    TimeZone::America_Halifax,
+    TimeZone::America_Glace_Bay,
+    TimeZone::America_Moncton,
+    TimeZone::America_Goose_Bay,
+    TimeZone::America_Blanc_Sablon,
+    TimeZone::America_Toronto,
+    TimeZone::America_Nipigon,
+    TimeZone::America_Thunder_Bay,
+    TimeZone::America_Iqaluit,
+    TimeZone::America_Pangnirtung,
+    TimeZone::America_Atikokan,
+    TimeZone::America_Winnipeg,
+    TimeZone::America_Rainy_River,
+    TimeZone::America_Resolute,
+    TimeZone::America_Rankin_Inlet,
+    TimeZone::America_Regina,
+    TimeZone::America_Swift_Current,
+    TimeZone::America_Edmonton,
+    TimeZone::America_Cambridge_Bay,
+    TimeZone::America_Yellowknife,
+    TimeZone::America_Inuvik,
+    TimeZone::America_Creston,
+    TimeZone::America_Dawson_Creek,
+    TimeZone::America_Fort_Nelson,
+    TimeZone::America_Vancouver,
+    TimeZone::America_Whitehorse,
+    TimeZone::America_Dawson,
+    TimeZone::Indian_Cocos,
+    TimeZone::Africa_Kinshasa,
+    TimeZone::Africa_Lubumbashi,
+    TimeZone::Africa_Bangui,
+    TimeZone::Africa_Brazzaville,
+    TimeZone::Europe_Zurich,
+    TimeZone::Africa_Abidjan,
+    TimeZone::Pacific_Rarotonga,
+    TimeZone::America_Santiago,
+    TimeZone::America_Punta_Arenas,
+    TimeZone::Pacific_Easter,
+    TimeZone::Africa_Douala,
+    TimeZone::Asia_Shanghai,
+    TimeZone::Asia_Urumqi,
+    TimeZone::America_Bogota,
+    TimeZone::America_Costa_Rica,
+    TimeZone::America_Havana,
+    TimeZone::Atlantic_Cape_Verde,
+    TimeZone::America_Curacao,
+    TimeZone::Indian_Christmas,
+    TimeZone::Asia_Nicosia,
+    TimeZone::Asia_Famagusta,
+    TimeZone::Europe_Prague,
+    TimeZone::Europe_Berlin,
+    TimeZone::Europe_Busingen,
+    TimeZone::Africa_Djibouti,
+    TimeZone::Europe_Copenhagen,
+    TimeZone::America_Dominica,
+    TimeZone::America_Santo_Domingo,
+    TimeZone::Africa_Algiers,
+    TimeZone::America_Guayaquil,
+    TimeZone::Pacific_Galapagos,
+    TimeZone::Europe_Tallinn,
+    TimeZone::Africa_Cairo,
+    TimeZone::Africa_El_Aaiun,
+    TimeZone::Africa_Asmara,
+    TimeZone::Europe_Madrid,
+    TimeZone::Africa_Ceuta,
+    TimeZone::Atlantic_Canary,
+    TimeZone::Africa_Addis_Ababa,
+    TimeZone::Europe_Helsinki,
+    TimeZone::Pacific_Fiji,
+    TimeZone::Atlantic_Stanley,
+    TimeZone::Pacific_Chuuk,
+    TimeZone::Pacific_Pohnpei,
+    TimeZone::Pacific_Kosrae,
+    TimeZone::Atlantic_Faroe,
+    TimeZone::Europe_Paris,
+    TimeZone::Africa_Libreville,
+    TimeZone::Europe_London,
+    TimeZone::America_Grenada,
+    TimeZone::Asia_Tbilisi,
+    TimeZone::America_Cayenne,
+    TimeZone::Europe_Guernsey,
+    TimeZone::Africa_Accra,
+    TimeZone::Europe_Gibraltar,
+    TimeZone::America_Nuuk,
+    TimeZone::America_Danmarkshavn,
+    TimeZone::America_Scoresbysund,
+    TimeZone::America_Thule,
+    TimeZone::Africa_Banjul,
+    TimeZone::Africa_Conakry,
+    TimeZone::America_Guadeloupe,
+    TimeZone::Africa_Malabo,
+    TimeZone::Europe_Athens,
+    TimeZone::Atlantic_South_Georgia,
+    TimeZone::America_Guatemala,
+    TimeZone::Pacific_Guam,
+    TimeZone::Africa_Bissau,
+    TimeZone::America_Guyana,
+    TimeZone::Asia_Hong_Kong,
+    TimeZone::America_Tegucigalpa,
+    TimeZone::Europe_Zagreb,
+    TimeZone::America_Port_au_Prince,
+    TimeZone::Europe_Budapest,
+    TimeZone::Asia_Jakarta,
+    TimeZone::Asia_Pontianak,
+    TimeZone::Asia_Makassar,
+    TimeZone::Asia_Jayapura,
+    TimeZone::Europe_Dublin,
+    TimeZone::Asia_Jerusalem,
+    TimeZone::Europe_Isle_of_Man,
+    TimeZone::Asia_Kolkata,
+    TimeZone::Indian_Chagos,
+    TimeZone::Asia_Baghdad,
+    TimeZone::Asia_Tehran,
+    TimeZone::Atlantic_Reykjavik,
+    TimeZone::Europe_Rome,
+    TimeZone::Europe_Jersey,
+    TimeZone::America_Jamaica,
+    TimeZone::Asia_Amman,
+    TimeZone::Asia_Tokyo,
+    TimeZone::Africa_Nairobi,
+    TimeZone::Asia_Bishkek,
+    TimeZone::Asia_Phnom_Penh,
+    TimeZone::Pacific_Tarawa,
+    TimeZone::Pacific_Enderbury,
+    TimeZone::Pacific_Kiritimati,
+    TimeZone::Indian_Comoro,
+    TimeZone::America_St_Kitts,
+    TimeZone::Asia_Pyongyang,
+    TimeZone::Asia_Seoul,
+    TimeZone::Asia_Kuwait,
+    TimeZone::America_Cayman,
+    TimeZone::Asia_Almaty,
+    TimeZone::Asia_Qyzylorda,
+    TimeZone::Asia_Qostanay,
+    TimeZone::Asia_Aqtobe,
+    TimeZone::Asia_Aqtau,
+    TimeZone::Asia_Atyrau,
+    TimeZone::Asia_Oral,
+    TimeZone::Asia_Vientiane,
+    TimeZone::Asia_Beirut,
+    TimeZone::America_St_Lucia,
+    TimeZone::Europe_Vaduz,
+    TimeZone::Asia_Colombo,
+    TimeZone::Africa_Monrovia,
+    TimeZone::Africa_Maseru,
+    TimeZone::Europe_Vilnius,
+    TimeZone::Europe_Luxembourg,
+    TimeZone::Europe_Riga,
+    TimeZone::Africa_Tripoli,
+    TimeZone::Africa_Casablanca,
+    TimeZone::Europe_Monaco,
+    TimeZone::Europe_Chisinau,
+    TimeZone::Europe_Podgorica,
+    TimeZone::America_Marigot,
+    TimeZone::Indian_Antananarivo,
+    TimeZone::Pacific_Majuro,
+    TimeZone::Pacific_Kwajalein,
+    TimeZone::Europe_Skopje,
+    TimeZone::Africa_Bamako,
+    TimeZone::Asia_Yangon,
+    TimeZone::Asia_Ulaanbaatar,
+    TimeZone::Asia_Hovd,
+    TimeZone::Asia_Choibalsan,
+    TimeZone::Asia_Macau,
+    TimeZone::Pacific_Saipan,
+    TimeZone::America_Martinique,
+    TimeZone::Africa_Nouakchott,
+    TimeZone::America_Montserrat,
+    TimeZone::Europe_Malta,
+    TimeZone::Indian_Mauritius,
+    TimeZone::Indian_Maldives,
+    TimeZone::Africa_Blantyre,
+    TimeZone::America_Mexico_City,
+    TimeZone::America_Cancun,
+    TimeZone::America_Merida,
+    TimeZone::America_Monterrey,
+    TimeZone::America_Matamoros,
+    TimeZone::America_Mazatlan,
+    TimeZone::America_Chihuahua,
+    TimeZone::America_Ojinaga,
+    TimeZone::America_Hermosillo,
+    TimeZone::America_Tijuana,
+    TimeZone::America_Bahia_Banderas,
+    TimeZone::Asia_Kuala_Lumpur,
+    TimeZone::Asia_Kuching,
+    TimeZone::Africa_Maputo,
+    TimeZone::Africa_Windhoek,
+    TimeZone::Pacific_Noumea,
+    TimeZone::Africa_Niamey,
+    TimeZone::Pacific_Norfolk,
+    TimeZone::Africa_Lagos,
+    TimeZone::America_Managua,
+    TimeZone::Europe_Amsterdam,
+    TimeZone::Europe_Oslo,
+    TimeZone::Asia_Kathmandu,
+    TimeZone::Pacific_Nauru,
+    TimeZone::Pacific_Niue,
+    TimeZone::Pacific_Auckland,
+    TimeZone::Pacific_Chatham,
+    TimeZone::Asia_Muscat,
+    TimeZone::America_Panama,
+    TimeZone::America_Lima,
+    TimeZone::Pacific_Tahiti,
+    TimeZone::Pacific_Marquesas,
+    TimeZone::Pacific_Gambier,
+    TimeZone::Pacific_Port_Moresby,
+    TimeZone::Pacific_Bougainville,
+    TimeZone::Asia_Manila,
+    TimeZone::Asia_Karachi,
+    TimeZone::Europe_Warsaw,
+    TimeZone::America_Miquelon,
+    TimeZone::Pacific_Pitcairn,
+    TimeZone::America_Puerto_Rico,
+    TimeZone::Asia_Gaza,
+    TimeZone::Asia_Hebron,
+    TimeZone::Europe_Lisbon,
+    TimeZone::Atlantic_Madeira,
+    TimeZone::Atlantic_Azores,
+    TimeZone::Pacific_Palau,
+    TimeZone::America_Asuncion,
+    TimeZone::Asia_Qatar,
+    TimeZone::Indian_Reunion,
+    TimeZone::Europe_Bucharest,
+    TimeZone::Europe_Belgrade,
+    TimeZone::Europe_Kaliningrad,
+    TimeZone::Europe_Moscow,
+    TimeZone::Europe_Kirov,
+    TimeZone::Europe_Astrakhan,
+    TimeZone::Europe_Volgograd,
+    TimeZone::Europe_Saratov,
+    TimeZone::Europe_Ulyanovsk,
+    TimeZone::Europe_Samara,
+    TimeZone::Asia_Yekaterinburg,
+    TimeZone::Asia_Omsk,
+    TimeZone::Asia_Novosibirsk,
+    TimeZone::Asia_Barnaul,
+    TimeZone::Asia_Tomsk,
+    TimeZone::Asia_Novokuznetsk,
+    TimeZone::Asia_Krasnoyarsk,
+    TimeZone::Asia_Irkutsk,
+    TimeZone::Asia_Chita,
+    TimeZone::Asia_Yakutsk,
+    TimeZone::Asia_Khandyga,
+    TimeZone::Asia_Vladivostok,
+    TimeZone::Asia_Ust_Nera,
+    TimeZone::Asia_Magadan,
+    TimeZone::Asia_Sakhalin,
+    TimeZone::Asia_Srednekolymsk,
+    TimeZone::Asia_Kamchatka,
+    TimeZone::Asia_Anadyr,
+    TimeZone::Africa_Kigali,
+    TimeZone::Asia_Riyadh,
+    TimeZone::Pacific_Guadalcanal,
+    TimeZone::Indian_Mahe,
+    TimeZone::Africa_Khartoum,
+    TimeZone::Europe_Stockholm,
+    TimeZone::Asia_Singapore,
+    TimeZone::Atlantic_St_Helena,
+    TimeZone::Europe_Ljubljana,
+    TimeZone::Arctic_Longyearbyen,
+    TimeZone::Europe_Bratislava,
+    TimeZone::Africa_Freetown,
+    TimeZone::Europe_San_Marino,
+    TimeZone::Africa_Dakar,
+    TimeZone::Africa_Mogadishu,
+    TimeZone::America_Paramaribo,
+    TimeZone::Africa_Juba,
+    TimeZone::Africa_Sao_Tome,
+    TimeZone::America_El_Salvador,
+    TimeZone::America_Lower_Princes,
+    TimeZone::Asia_Damascus,
+    TimeZone::Africa_Mbabane,
+    TimeZone::America_Grand_Turk,
+    TimeZone::Africa_Ndjamena,
+    TimeZone::Indian_Kerguelen,
+    TimeZone::Africa_Lome,
+    TimeZone::Asia_Bangkok,
+    TimeZone::Asia_Dushanbe,
+    TimeZone::Pacific_Fakaofo,
+    TimeZone::Asia_Dili,
+    TimeZone::Asia_Ashgabat,
+    TimeZone::Africa_Tunis,
+    TimeZone::Pacific_Tongatapu,
+    TimeZone::Europe_Istanbul,
+    TimeZone::America_Port_of_Spain,
+    TimeZone::Pacific_Funafuti,
+    TimeZone::Asia_Taipei,
+    TimeZone::Africa_Dar_es_Salaam,
+    TimeZone::Europe_Simferopol,
+    TimeZone::Europe_Kiev,
+    TimeZone::Europe_Uzhgorod,
+    TimeZone::Europe_Zaporozhye,
+    TimeZone::Africa_Kampala,
+    TimeZone::Pacific_Midway,
+    TimeZone::Pacific_Wake,
+    TimeZone::America_New_York,
+    TimeZone::America_Detroit,
+    TimeZone::America_Kentucky_Louisville,
+    TimeZone::America_Kentucky_Monticello,
+    TimeZone::America_Indiana_Indianapolis,
+    TimeZone::America_Indiana_Vincennes,
+    TimeZone::America_Indiana_Winamac,
+    TimeZone::America_Indiana_Marengo,
+    TimeZone::America_Indiana_Petersburg,
+    TimeZone::America_Indiana_Vevay,
+    TimeZone::America_Chicago,
+    TimeZone::America_Indiana_Tell_City,
+    TimeZone::America_Indiana_Knox,
+    TimeZone::America_Menominee,
+    TimeZone::America_North_Dakota_Center,
+    TimeZone::America_North_Dakota_New_Salem,
+    TimeZone::America_North_Dakota_Beulah,
+    TimeZone::America_Denver,
+    TimeZone::America_Boise,
+    TimeZone::America_Phoenix,
+    TimeZone::America_Los_Angeles,
+    TimeZone::America_Anchorage,
+    TimeZone::America_Juneau,
+    TimeZone::America_Sitka,
+    TimeZone::America_Metlakatla,
+    TimeZone::America_Yakutat,
+    TimeZone::America_Nome,
+    TimeZone::America_Adak,
+    TimeZone::Pacific_Honolulu,
+    TimeZone::America_Montevideo,
+    TimeZone::Asia_Samarkand,
+    TimeZone::Asia_Tashkent,
+    TimeZone::Europe_Vatican,
+    TimeZone::America_St_Vincent,
+    TimeZone::America_Caracas,
+    TimeZone::America_Tortola,
+    TimeZone::America_St_Thomas,
+    TimeZone::Asia_Ho_Chi_Minh,
+    TimeZone::Pacific_Efate,
+    TimeZone::Pacific_Wallis,
+    TimeZone::Pacific_Apia,
+    TimeZone::Asia_Aden,
+    TimeZone::Indian_Mayotte,
+    TimeZone::Africa_Johannesburg,
+    TimeZone::Africa_Lusaka,
+    TimeZone::Africa_Harare
+};
+static constexpr Country TimeZoneCountries[] = {
+    Country::Invalid,
+    Country::ISO_AD,
+    Country::ISO_AE,
+    Country::ISO_AF,
+    Country::ISO_AG,
+    Country::ISO_AI,
+    Country::ISO_AL,
+    Country::ISO_AM,
+    Country::ISO_AO,
+    Country::ISO_AQ,
+    Country::ISO_AQ,
+    Country::ISO_AQ,
+    Country::ISO_AQ,
+    Country::ISO_AQ,
+    Country::ISO_AQ,
+    Country::ISO_AQ,
+    Country::ISO_AQ,
+    Country::ISO_AQ,
+    Country::ISO_AQ,
+    Country::ISO_AR,
+    Country::ISO_AR,
+    Country::ISO_AR,
+    Country::ISO_AR,
+    Country::ISO_AR,
+    Country::ISO_AR,
+    Country::ISO_AR,
+    Country::ISO_AR,
+    Country::ISO_AR,
+    Country::ISO_AR,
+    Country::ISO_AR,
+    Country::ISO_AR,
+    Country::ISO_AS,
+    Country::ISO_AT,
+    Country::ISO_AU,
+    Country::ISO_AU,
+    Country::ISO_AU,
+    Country::ISO_AU,
+    Country::ISO_AU,
+    Country::ISO_AU,
+    Country::ISO_AU,
+    Country::ISO_AU,
+    Country::ISO_AU,
+    Country::ISO_AU,
+    Country::ISO_AU,
+    Country::ISO_AU,
+    Country::ISO_AU,
+    Country::ISO_AW,
+    Country::ISO_AX,
+    Country::ISO_AZ,
+    Country::ISO_BA,
+    Country::ISO_BB,
+    Country::ISO_BD,
+    Country::ISO_BE,
+    Country::ISO_BF,
+    Country::ISO_BG,
+    Country::ISO_BH,
+    Country::ISO_BI,
+    Country::ISO_BJ,
+    Country::ISO_BL,
+    Country::ISO_BM,
+    Country::ISO_BN,
+    Country::ISO_BO,
+    Country::ISO_BQ,
+    Country::ISO_BR,
+    Country::ISO_BR,
+    Country::ISO_BR,
+    Country::ISO_BR,
+    Country::ISO_BR,
+    Country::ISO_BR,
+    Country::ISO_BR,
+    Country::ISO_BR,
+    Country::ISO_BR,
+    Country::ISO_BR,
+    Country::ISO_BR,
+    Country::ISO_BR,
+    Country::ISO_BR,
+    Country::ISO_BR,
+    Country::ISO_BR,
+    Country::ISO_BR,
+    Country::ISO_BS,
+    Country::ISO_BT,
+    Country::ISO_BW,
+    Country::ISO_BY,
+    Country::ISO_BZ,
+    Country::ISO_CA,
+    Country::ISO_CA,
+    Country::ISO_CA,
+    Country::ISO_CA,
+    Country::ISO_CA,
+    Country::ISO_CA,
+    Country::ISO_CA,
+    Country::ISO_CA,
+    Country::ISO_CA,
+    Country::ISO_CA,
+    Country::ISO_CA,
+    Country::ISO_CA,
+    Country::ISO_CA,
+    Country::ISO_CA,
+    Country::ISO_CA,
+    Country::ISO_CA,
+    Country::ISO_CA,
+    Country::ISO_CA,
+    Country::ISO_CA,
+    Country::ISO_CA,
+    Country::ISO_CA,
+    Country::ISO_CA,
+    Country::ISO_CA,
+    Country::ISO_CA,
+    Country::ISO_CA,
+    Country::ISO_CA,
+    Country::ISO_CA,
+    Country::ISO_CA,
+    Country::ISO_CC,
+    Country::ISO_CD,
+    Country::ISO_CD,
+    Country::ISO_CF,
+    Country::ISO_CG,
+    Country::ISO_CH,
+    Country::ISO_CI,
+    Country::ISO_CK,
+    Country::ISO_CL,
+    Country::ISO_CL,
+    Country::ISO_CL,
+    Country::ISO_CM,
+    Country::ISO_CN,
+    Country::ISO_CN,
+    Country::ISO_CO,
+    Country::ISO_CR,
+    Country::ISO_CU,
+    Country::ISO_CV,
+    Country::ISO_CW,
+    Country::ISO_CX,
+    Country::ISO_CY,
+    Country::ISO_CY,
+    Country::ISO_CZ,
+    Country::ISO_DE,
+    Country::ISO_DE,
+    Country::ISO_DJ,
+    Country::ISO_DK,
+    Country::ISO_DM,
+    Country::ISO_DO,
+    Country::ISO_DZ,
+    Country::ISO_EC,
+    Country::ISO_EC,
+    Country::ISO_EE,
+    Country::ISO_EG,
+    Country::ISO_EH,
+    Country::ISO_ER,
+    Country::ISO_ES,
+    Country::ISO_ES,
+    Country::ISO_ES,
+    Country::ISO_ET,
+    Country::ISO_FI,
+    Country::ISO_FJ,
+    Country::ISO_FK,
+    Country::ISO_FM,
+    Country::ISO_FM,
+    Country::ISO_FM,
+    Country::ISO_FO,
+    Country::ISO_FR,
+    Country::ISO_GA,
+    Country::ISO_GB,
+    Country::ISO_GD,
+    Country::ISO_GE,
+    Country::ISO_GF,
+    Country::ISO_GG,
+    Country::ISO_GH,
+    Country::ISO_GI,
+    Country::ISO_GL,
+    Country::ISO_GL,
+    Country::ISO_GL,
+    Country::ISO_GL,
+    Country::ISO_GM,
+    Country::ISO_GN,
+    Country::ISO_GP,
+    Country::ISO_GQ,
+    Country::ISO_GR,
+    Country::ISO_GS,
+    Country::ISO_GT,
+    Country::ISO_GU,
+    Country::ISO_GW,
+    Country::ISO_GY,
+    Country::ISO_HK,
+    Country::ISO_HN,
+    Country::ISO_HR,
+    Country::ISO_HT,
+    Country::ISO_HU,
+    Country::ISO_ID,
+    Country::ISO_ID,
+    Country::ISO_ID,
+    Country::ISO_ID,
+    Country::ISO_IE,
+    Country::ISO_IL,
+    Country::ISO_IM,
+    Country::ISO_IN,
+    Country::ISO_IO,
+    Country::ISO_IQ,
+    Country::ISO_IR,
+    Country::ISO_IS,
+    Country::ISO_IT,
+    Country::ISO_JE,
+    Country::ISO_JM,
+    Country::ISO_JO,
+    Country::ISO_JP,
+    Country::ISO_KE,
+    Country::ISO_KG,
+    Country::ISO_KH,
+    Country::ISO_KI,
+    Country::ISO_KI,
+    Country::ISO_KI,
+    Country::ISO_KM,
+    Country::ISO_KN,
+    Country::ISO_KP,
+    Country::ISO_KR,
+    Country::ISO_KW,
+    Country::ISO_KY,
+    Country::ISO_KZ,
+    Country::ISO_KZ,
+    Country::ISO_KZ,
+    Country::ISO_KZ,
+    Country::ISO_KZ,
+    Country::ISO_KZ,
+    Country::ISO_KZ,
+    Country::ISO_LA,
+    Country::ISO_LB,
+    Country::ISO_LC,
+    Country::ISO_LI,
+    Country::ISO_LK,
+    Country::ISO_LR,
+    Country::ISO_LS,
+    Country::ISO_LT,
+    Country::ISO_LU,
+    Country::ISO_LV,
+    Country::ISO_LY,
+    Country::ISO_MA,
+    Country::ISO_MC,
+    Country::ISO_MD,
+    Country::ISO_ME,
+    Country::ISO_MF,
+    Country::ISO_MG,
+    Country::ISO_MH,
+    Country::ISO_MH,
+    Country::ISO_MK,
+    Country::ISO_ML,
+    Country::ISO_MM,
+    Country::ISO_MN,
+    Country::ISO_MN,
+    Country::ISO_MN,
+    Country::ISO_MO,
+    Country::ISO_MP,
+    Country::ISO_MQ,
+    Country::ISO_MR,
+    Country::ISO_MS,
+    Country::ISO_MT,
+    Country::ISO_MU,
+    Country::ISO_MV,
+    Country::ISO_MW,
+    Country::ISO_MX,
+    Country::ISO_MX,
+    Country::ISO_MX,
+    Country::ISO_MX,
+    Country::ISO_MX,
+    Country::ISO_MX,
+    Country::ISO_MX,
+    Country::ISO_MX,
+    Country::ISO_MX,
+    Country::ISO_MX,
+    Country::ISO_MX,
+    Country::ISO_MY,
+    Country::ISO_MY,
+    Country::ISO_MZ,
+    Country::ISO_NA,
+    Country::ISO_NC,
+    Country::ISO_NE,
+    Country::ISO_NF,
+    Country::ISO_NG,
+    Country::ISO_NI,
+    Country::ISO_NL,
+    Country::ISO_NO,
+    Country::ISO_NP,
+    Country::ISO_NR,
+    Country::ISO_NU,
+    Country::ISO_NZ,
+    Country::ISO_NZ,
+    Country::ISO_OM,
+    Country::ISO_PA,
+    Country::ISO_PE,
+    Country::ISO_PF,
+    Country::ISO_PF,
+    Country::ISO_PF,
+    Country::ISO_PG,
+    Country::ISO_PG,
+    Country::ISO_PH,
+    Country::ISO_PK,
+    Country::ISO_PL,
+    Country::ISO_PM,
+    Country::ISO_PN,
+    Country::ISO_PR,
+    Country::ISO_PS,
+    Country::ISO_PS,
+    Country::ISO_PT,
+    Country::ISO_PT,
+    Country::ISO_PT,
+    Country::ISO_PW,
+    Country::ISO_PY,
+    Country::ISO_QA,
+    Country::ISO_RE,
+    Country::ISO_RO,
+    Country::ISO_RS,
+    Country::ISO_RU,
+    Country::ISO_RU,
+    Country::ISO_UA,
+    Country::ISO_RU,
+    Country::ISO_RU,
+    Country::ISO_RU,
+    Country::ISO_RU,
+    Country::ISO_RU,
+    Country::ISO_RU,
+    Country::ISO_RU,
+    Country::ISO_RU,
+    Country::ISO_RU,
+    Country::ISO_RU,
+    Country::ISO_RU,
+    Country::ISO_RU,
+    Country::ISO_RU,
+    Country::ISO_RU,
+    Country::ISO_RU,
+    Country::ISO_RU,
+    Country::ISO_RU,
+    Country::ISO_RU,
+    Country::ISO_RU,
+    Country::ISO_RU,
+    Country::ISO_RU,
+    Country::ISO_RU,
+    Country::ISO_RU,
+    Country::ISO_RU,
+    Country::ISO_RW,
+    Country::ISO_SA,
+    Country::ISO_SB,
+    Country::ISO_SC,
+    Country::ISO_SD,
+    Country::ISO_SE,
+    Country::ISO_SG,
+    Country::ISO_SH,
+    Country::ISO_SI,
+    Country::ISO_SJ,
+    Country::ISO_SK,
+    Country::ISO_SL,
+    Country::ISO_SM,
+    Country::ISO_SN,
+    Country::ISO_SO,
+    Country::ISO_SR,
+    Country::ISO_SS,
+    Country::ISO_ST,
+    Country::ISO_SV,
+    Country::ISO_SX,
+    Country::ISO_SY,
+    Country::ISO_SZ,
+    Country::ISO_TC,
+    Country::ISO_TD,
+    Country::ISO_TF,
+    Country::ISO_TG,
+    Country::ISO_TH,
+    Country::ISO_TJ,
+    Country::ISO_TK,
+    Country::ISO_TL,
+    Country::ISO_TM,
+    Country::ISO_TN,
+    Country::ISO_TO,
+    Country::ISO_TR,
+    Country::ISO_TT,
+    Country::ISO_TV,
+    Country::ISO_TW,
+    Country::ISO_TZ,
+    Country::ISO_UA,
+    Country::ISO_UA,
+    Country::ISO_UA,
+    Country::ISO_UG,
+    Country::ISO_UM,
+    Country::ISO_UM,
+    Country::ISO_US,
+    Country::ISO_US,
+    Country::ISO_US,
+    Country::ISO_US,
+    Country::ISO_US,
+    Country::ISO_US,
+    Country::ISO_US,
+    Country::ISO_US,
+    Country::ISO_US,
+    Country::ISO_US,
+    Country::ISO_US,
+    Country::ISO_US,
+    Country::ISO_US,
+    Country::ISO_US,
+    Country::ISO_US,
+    Country::ISO_US,
+    Country::ISO_US,
+    Country::ISO_US,
+    Country::ISO_US,
+    Country::ISO_US,
+    Country::ISO_US,
+    Country::ISO_US,
+    Country::ISO_US,
+    Country::ISO_US,
+    Country::ISO_US,
+    Country::ISO_US,
+    Country::ISO_US,
+    Country::ISO_US,
+    Country::ISO_US,
+    Country::ISO_UY,
+    Country::ISO_UZ,
+    Country::ISO_UZ,
+    Country::ISO_VA,
+    Country::ISO_VC,
+    Country::ISO_VE,
+    Country::ISO_VG,
+    Country::ISO_VI,
+    Country::ISO_VN,
+    Country::ISO_VU,
+    Country::ISO_WF,
+    Country::ISO_WS,
+    Country::ISO_YE,
+    Country::ISO_YT,
+    Country::ISO_ZA,
+    Country::ISO_ZM,
+    Country::ISO_ZW
+};
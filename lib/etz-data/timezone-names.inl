@@ -1,428 +1,514 @@
-static constexpr const char* TimeZoneNames[] {
-    "Invalid",
-    "Europe/Andorra",
-    "Asia/Dubai",
-    "Asia/Kabul",
-    "America/Antigua",
-    "America/Anguilla",
-    "Europe/Tirane",
-    "Asia/Yerevan",
-    "Africa/Luanda",
-    "Antarctica/McMurdo",
-    "Antarctica/Casey",
-    "Antarctica/Davis",
-    "Antarctica/DumontDUrville",
-    "Antarctica/Mawson",
-    "Antarctica/Palmer",
-    "Antarctica/Rothera",
-    "Antarctica/Syowa",
-    "Antarctica/Troll",
-    "Antarctica/Vostok",
-    "America/Argentina/Buenos_Aires",
-    "America/Argentina/Cordoba",
-    "America/Argentina/Salta",
-    "America/Argentina/Jujuy",
-    "America/Argentina/Tucuman",
-    "America/Argentina/Catamarca",
-    "America/Argentina/La_Rioja",
-    "America/Argentina/San_Juan",
-    "America/Argentina/Mendoza",
-    "America/Argentina/San_Luis",
-    "America/Argentina/Rio_Gallegos",
-    "America/Argentina/Ushuaia",
-    "Pacific/Pago_Pago",
-    "Europe/Vienna",
-    "Australia/Lord_Howe",
-    "Antarctica/Macquarie",
-    "Australia/Hobart",
-    "Australia/Currie",
-    "Australia/Melbourne",
-    "Australia/Sydney",
-    "Australia/Broken_Hill",
-    "Australia/Brisbane",
-    "Australia/Lindeman",
-    "Australia/Adelaide",
-    "Australia/Darwin",
-    "Australia/Perth",
-    "Australia/Eucla",
-    "America/Aruba",
-    "Europe/Mariehamn",
-    "Asia/Baku",
-    "Europe/Sarajevo",
-    "America/Barbados",
-    "Asia/Dhaka",
-    "Europe/Brussels",
-    "Africa/Ouagadougou",
-    "Europe/Sofia",
-    "Asia/Bahrain",
-    "Africa/Bujumbura",
-    "Africa/Porto-Novo",
-    "America/St_Barthelemy",
-    "Atlantic/Bermuda",
-    "Asia/Brunei",
-    "America/La_Paz",
-    "America/Kralendijk",
-    "America/Noronha",
-    "America/Belem",
-    "America/Fortaleza",
-    "America/Recife",
-    "America/Araguaina",
-    "America/Maceio",
-    "America/Bahia",
-    "America/Sao_Paulo",
-    "America/Campo_Grande",
-    "America/Cuiaba",
-    "America/Santarem",
-    "America/Porto_Velho",
-    "America/Boa_Vista",
-    "America/Manaus",
-    "America/Eirunepe",
-    "America/Rio_Branco",
-    "America/Nassau",
-    "Asia/Thimphu",
-    "Africa/Gaborone",
-    "Europe/Minsk",
-    "America/Belize",
-    "America/St_Johns",
-    "America/Halifax",
-    "America/Glace_Bay",
-    "America/Moncton",
-    "America/Goose_Bay",
-    "America/Blanc-Sablon",
-    "America/Toronto",
-    "America/Nipigon",
-    "America/Thunder_Bay",
-    "America/Iqaluit",
-    "America/Pangnirtung",
-    "America/Atikokan",
-    "America/Winnipeg",
-    "America/Rainy_River",
-    "America/Resolute",
-    "America/Rankin_Inlet",
-    "America/Regina",
-    "America/Swift_Current",
-    "America/Edmonton",
-    "America/Cambridge_Bay",
-    "America/Yellowknife",
-    "America/Inuvik",
-    "America/Creston",
-    "America/Dawson_Creek",
-    "America/Fort_Nelson",
-    "America/Vancouver",
-    "America/Whitehorse",
-    "America/Dawson",
-    "Indian/Cocos",
-    "Africa/Kinshasa",
-    "Africa/Lubumbashi",
-    "Africa/Bangui",
-    "Africa/Brazzaville",
-    "Europe/Zurich",
-    "Africa/Abidjan",
-    "Pacific/Rarotonga",
-    "America/Santiago",
-    "America/Punta_Arenas",
-    "Pacific/Easter",
-    "Africa/Douala",
-    "Asia/Shanghai",
-    "Asia/Urumqi",
-    "America/Bogota",
-    "America/Costa_Rica",
-    "America/Havana",
-    "Atlantic/Cape_Verde",
-    "America/Curacao",
-    "Indian/Christmas",
-    "Asia/Nicosia",
-    "Asia/Famagusta",
-    "Europe/Prague",
-    "Europe/Berlin",
-    "Europe/Busingen",
-    "Africa/Djibouti",
-    "Europe/Copenhagen",
-    "America/Dominica",
-    "America/Santo_Domingo",
-    "Africa/Algiers",
-    "America/Guayaquil",
-    "Pacific/Galapagos",
-    "Europe/Tallinn",
-    "Africa/Cairo",
-    "Africa/El_Aaiun",
-    "Africa/Asmara",
-    "Europe/Madrid",
-    "Africa/Ceuta",
-    "Atlantic/Canary",
-    "Africa/Addis_Ababa",
-    "Europe/Helsinki",
-    "Pacific/Fiji",
-    "Atlantic/Stanley",
-    "Pacific/Chuuk",
-    "Pacific/Pohnpei",
-    "Pacific/Kosrae",
-    "Atlantic/Faroe",
-    "Europe/Paris",
-    "Africa/Libreville",
-    "Europe/London",
-    "America/Grenada",
-    "Asia/Tbilisi",
-    "America/Cayenne",
-    "Europe/Guernsey",
-    "Africa/Accra",
-    "Europe/Gibraltar",
-    "America/Nuuk",
-    "America/Danmarkshavn",
-    "America/Scoresbysund",
-    "America/Thule",
-    "Africa/Banjul",
-    "Africa/Conakry",
-    "America/Guadeloupe",
-    "Africa/Malabo",
-    "Europe/Athens",
-    "Atlantic/South_Georgia",
-    "America/Guatemala",
-    "Pacific/Guam",
-    "Africa/Bissau",
-    "America/Guyana",
-    "Asia/Hong_Kong",
-    "America/Tegucigalpa",
-    "Europe/Zagreb",
-    "America/Port-au-Prince",
-    "Europe/Budapest",
-    "Asia/Jakarta",
-    "Asia/Pontianak",
-    "Asia/Makassar",
-    "Asia/Jayapura",
-    "Europe/Dublin",
-    "Asia/Jerusalem",
-    "Europe/Isle_of_Man",
-    "Asia/Kolkata",
-    "Indian/Chagos",
-    "Asia/Baghdad",
-    "Asia/Tehran",
-    "Atlantic/Reykjavik",
-    "Europe/Rome",
-    "Europe/Jersey",
-    "America/Jamaica",
-    "Asia/Amman",
-    "Asia/Tokyo",
-    "Africa/Nairobi",
-    "Asia/Bishkek",
-    "Asia/Phnom_Penh",
-    "Pacific/Tarawa",
-    "Pacific/Enderbury",
-    "Pacific/Kiritimati",
-    "Indian/Comoro",
-    "America/St_Kitts",
-    "Asia/Pyongyang",
-    "Asia/Seoul",
-    "Asia/Kuwait",
-    "America/Cayman",
-    "Asia/Almaty",
-    "Asia/Qyzylorda",
-    "Asia/Qostanay",
-    "Asia/Aqtobe",
-    "Asia/Aqtau",
-    "Asia/Atyrau",
-    "Asia/Oral",
-    "Asia/Vientiane",
-    "Asia/Beirut",
-    "America/St_Lucia",
-    "Europe/Vaduz",
-    "Asia/Colombo",
-    "Africa/Monrovia",
-    "Africa/Maseru",
-    "Europe/Vilnius",
-    "Europe/Luxembourg",
-    "Europe/Riga",
-    "Africa/Tripoli",
-    "Africa/Casablanca",
-    "Europe/Monaco",
-    "Europe/Chisinau",
-    "Europe/Podgorica",
-    "America/Marigot",
-    "Indian/Antananarivo",
-    "Pacific/Majuro",
-    "Pacific/Kwajalein",
-    "Europe/Skopje",
-    "Africa/Bamako",
-    "Asia/Yangon",
-    "Asia/Ulaanbaatar",
-    "Asia/Hovd",
-    "Asia/Choibalsan",
-    "Asia/Macau",
-    "Pacific/Saipan",
-    "America/Martinique",
-    "Africa/Nouakchott",
-    "America/Montserrat",
-    "Europe/Malta",
-    "Indian/Mauritius",
-    "Indian/Maldives",
-    "Africa/Blantyre",
-    "America/Mexico_City",
-    "America/Cancun",
-    "America/Merida",
-    "America/Monterrey",
-    "America/Matamoros",
-    "America/Mazatlan",
-    "America/Chihuahua",
-    "America/Ojinaga",
-    "America/Hermosillo",
-    "America/Tijuana",
-    "America/Bahia_Banderas",
-    "Asia/Kuala_Lumpur",
-    "Asia/Kuching",
-    "Africa/Maputo",
-    "Africa/Windhoek",
-    "Pacific/Noumea",
-    "Africa/Niamey",
-    "Pacific/Norfolk",
-    "Africa/Lagos",
-    "America/Managua",
-    "Europe/Amsterdam",
-    "Europe/Oslo",
-    "Asia/Kathmandu",
-    "Pacific/Nauru",
-    "Pacific/Niue",
-    "Pacific/Auckland",
-    "Pacific/Chatham",
-    "Asia/Muscat",
-    "America/Panama",
-    "America/Lima",
-    "Pacific/Tahiti",
-    "Pacific/Marquesas",
-    "Pacific/Gambier",
-    "Pacific/Port_Moresby",
-    "Pacific/Bougainville",
-    "Asia/Manila",
-    "Asia/Karachi",
-    "Europe/Warsaw",
-    "America/Miquelon",
-    "Pacific/Pitcairn",
-    "America/Puerto_Rico",
-    "Asia/Gaza",
-    "Asia/Hebron",
-    "Europe/Lisbon",
-    "Atlantic/Madeira",
-    "Atlantic/Azores",
-    "Pacific/Palau",
-    "America/Asuncion",
-    "Asia/Qatar",
-    "Indian/Reunion",
-    "Europe/Bucharest",
-    "Europe/Belgrade",
-    "Europe/Kaliningrad",
-    "Europe/Moscow",
-    "Europe/Simferopol",
-    "Europe/Kirov",
-    "Europe/Astrakhan",
-    "Europe/Volgograd",
-    "Europe/Saratov",
-    "Europe/Ulyanovsk",
-    "Europe/Samara",
-    "Asia/Yekaterinburg",
-    "Asia/Omsk",
-    "Asia/Novosibirsk",
-    "Asia/Barnaul",
-    "Asia/Tomsk",
-    "Asia/Novokuznetsk",
-    "Asia/Krasnoyarsk",
-    "Asia/Irkutsk",
-    "Asia/Chita",
-    "Asia/Yakutsk",
-    "Asia/Khandyga",
-    "Asia/Vladivostok",
-    "Asia/Ust-Nera",
-    "Asia/Magadan",
-    "Asia/Sakhalin",
-    "Asia/Srednekolymsk",
-    "Asia/Kamchatka",
-    "Asia/Anadyr",
-    "Africa/Kigali",
-    "Asia/Riyadh",
-    "Pacific/Guadalcanal",
-    "Indian/Mahe",
-    "Africa/Khartoum",
-    "Europe/Stockholm",
-    "Asia/Singapore",
-    "Atlantic/St_Helena",
-    "Europe/Ljubljana",
-    "Arctic/Longyearbyen",
-    "Europe/Bratislava",
-    "Africa/Freetown",
-    "Europe/San_Marino",
-    "Africa/Dakar",
-    "Africa/Mogadishu",
-    "America/Paramaribo",
-    "Africa/Juba",
-    "Africa/Sao_Tome",
-    "America/El_Salvador",
-    "America/Lower_Princes",
-    "Asia/Damascus",
-    "Africa/Mbabane",
-    "America/Grand_Turk",
-    "Africa/Ndjamena",
-    "Indian/Kerguelen",
-    "Africa/Lome",
-    "Asia/Bangkok",
-    "Asia/Dushanbe",
-    "Pacific/Fakaofo",
-    "Asia/Dili",
-    "Asia/Ashgabat",
-    "Africa/Tunis",
-    "Pacific/Tongatapu",
-    "Europe/Istanbul",
-    "America/Port_of_Spain",
-    "Pacific/Funafuti",
-    "Asia/Taipei",
-    "Africa/Dar_es_Salaam",
-    "Europe/Kiev",
-    "Europe/Uzhgorod",
-    "Europe/Zaporozhye",
-    "Africa/Kampala",
-    "Pacific/Midway",
-    "Pacific/Wake",
-    "America/New_York",
-    "America/Detroit",
-    "America/Kentucky/Louisville",
-    "America/Kentucky/Monticello",
-    "America/Indiana/Indianapolis",
-    "America/Indiana/Vincennes",
-    "America/Indiana/Winamac",
-    "America/Indiana/Marengo",
-    "America/Indiana/Petersburg",
-    "America/Indiana/Vevay",
-    "America/Chicago",
-    "America/Indiana/Tell_City",
-    "America/Indiana/Knox",
-    "America/Menominee",
-    "America/North_Dakota/Center",
-    "America/North_Dakota/New_Salem",
-    "America/North_Dakota/Beulah",
-    "America/Denver",
-    "America/Boise",
-    "America/Phoenix",
-    "America/Los_Angeles",
-    "America/Anchorage",
-    "America/Juneau",
-    "America/Sitka",
-    "America/Metlakatla",
-    "America/Yakutat",
-    "America/Nome",
-    "America/Adak",
-    "Pacific/Honolulu",
-    "America/Montevideo",
-    "Asia/Samarkand",
-    "Asia/Tashkent",
-    "Europe/Vatican",
-    "America/St_Vincent",
-    "America/Caracas",
-    "America/Tortola",
-    "America/St_Thomas",
-    "Asia/Ho_Chi_Minh",
-    "Pacific/Efate",
-    "Pacific/Wallis",
-    "Pacific/Apia",
-    "Asia/Aden",
-    "Indian/Mayotte",
-    "Africa/Johannesburg",
-    "Africa/Lusaka",
-    "Africa/Harare"
+static constexpr char TimeZoneNames[] =
+    "Invalid\0"
+    "Europe/Andorra\0"
+    "Asia/Dubai\0"
+    "Asia/Kabul\0"
+    "America/Antigua\0"
+    "America/Anguilla\0"
+    "Europe/Tirane\0"
+    "Asia/Yerevan\0"
+    "Africa/Luanda\0"
+    "Antarctica/McMurdo\0"
+    "Antarctica/Casey\0"
+    "Antarctica/Davis\0"
+    "Antarctica/DumontDUrville\0"
+    "Antarctica/Mawson\0"
+    "Antarctica/Palmer\0"
+    "Antarctica/Rothera\0"
+    "Antarctica/Syowa\0"
+    "Antarctica/Troll\0"
+    "Antarctica/Vostok\0"
+    "America/Argentina/Buenos_Aires\0"
+    "America/Argentina/Cordoba\0"
+    "America/Argentina/Salta\0"
+    "America/Argentina/Jujuy\0"
+    "America/Argentina/Tucuman\0"
+    "America/Argentina/Catamarca\0"
+    "America/Argentina/La_Rioja\0"
+    "America/Argentina/San_Juan\0"
+    "America/Argentina/Mendoza\0"
+    "America/Argentina/San_Luis\0"
+    "America/Argentina/Rio_Gallegos\0"
+    "America/Argentina/Ushuaia\0"
+    "Pacific/Pago_Pago\0"
+    "Europe/Vienna\0"
+    "Australia/Lord_Howe\0"
+    "Antarctica/Macquarie\0"
+    "Australia/Hobart\0"
+    "Australia/Currie\0"
+    "Australia/Melbourne\0"
+    "Australia/Sydney\0"
+    "Australia/Broken_Hill\0"
+    "Australia/Brisbane\0"
+    "Australia/Lindeman\0"
+    "Australia/Adelaide\0"
+    "Australia/Darwin\0"
+    "Australia/Perth\0"
+    "Australia/Eucla\0"
+    "America/Aruba\0"
+    "Europe/Mariehamn\0"
+    "Asia/Baku\0"
+    "Europe/Sarajevo\0"
+    "America/Barbados\0"
+    "Asia/Dhaka\0"
+    "Europe/Brussels\0"
+    "Africa/Ouagadougou\0"
+    "Europe/Sofia\0"
+    "Asia/Bahrain\0"
+    "Africa/Bujumbura\0"
+    "Africa/Porto-Novo\0"
+    "America/St_Barthelemy\0"
+    "Atlantic/Bermuda\0"
+    "Asia/Brunei\0"
+    "America/La_Paz\0"
+    "America/Kralendijk\0"
+    "America/Noronha\0"
+    "America/Belem\0"
+    "America/Fortaleza\0"
+    "America/Recife\0"
+    "America/Araguaina\0"
+    "America/Maceio\0"
+    "America/Bahia\0"
+    "America/Sao_Paulo\0"
+    "America/Campo_Grande\0"
+    "America/Cuiaba\0"
+    "America/Santarem\0"
+    "America/Porto_Velho\0"
+    "America/Boa_Vista\0"
+    "America/Manaus\0"
+    "America/Eirunepe\0"
+    "America/Rio_Branco\0"
+    "America/Nassau\0"
+    "Asia/Thimphu\0"
+    "Africa/Gaborone\0"
+    "Europe/Minsk\0"
+    "America/Belize\0"
+    "America/St_Johns\0"
+    "America/Halifax\0"
+    "America/Glace_Bay\0"
+    "America/Moncton\0"
+    "America/Goose_Bay\0"
+    "America/Blanc-Sablon\0"
+    "America/Toronto\0"
+    "America/Nipigon\0"
+    "America/Thunder_Bay\0"
+    "America/Iqaluit\0"
+    "America/Pangnirtung\0"
+    "America/Atikokan\0"
+    "America/Winnipeg\0"
+    "America/Rainy_River\0"
+    "America/Resolute\0"
+    "America/Rankin_Inlet\0"
+    "America/Regina\0"
+    "America/Swift_Current\0"
+    "America/Edmonton\0"
+    "America/Cambridge_Bay\0"
+    "America/Yellowknife\0"
+    "America/Inuvik\0"
+    "America/Creston\0"
+    "America/Dawson_Creek\0"
+    "America/Fort_Nelson\0"
+    "America/Vancouver\0"
+    "America/Whitehorse\0"
+    "America/Dawson\0"
+    "Indian/Cocos\0"
+    "Africa/Kinshasa\0"
+    "Africa/Lubumbashi\0"
+    "Africa/Bangui\0"
+    "Africa/Brazzaville\0"
+    "Europe/Zurich\0"
+    "Africa/Abidjan\0"
+    "Pacific/Rarotonga\0"
+    "America/Santiago\0"
+    "America/Punta_Arenas\0"
+    "Pacific/Easter\0"
+    "Africa/Douala\0"
+    "Asia/Shanghai\0"
+    "Asia/Urumqi\0"
+    "America/Bogota\0"
+    "America/Costa_Rica\0"
+    "America/Havana\0"
+    "Atlantic/Cape_Verde\0"
+    "America/Curacao\0"
+    "Indian/Christmas\0"
+    "Asia/Nicosia\0"
+    "Asia/Famagusta\0"
+    "Europe/Prague\0"
+    "Europe/Berlin\0"
+    "Europe/Busingen\0"
+    "Africa/Djibouti\0"
+    "Europe/Copenhagen\0"
+    "America/Dominica\0"
+    "America/Santo_Domingo\0"
+    "Africa/Algiers\0"
+    "America/Guayaquil\0"
+    "Pacific/Galapagos\0"
+    "Europe/Tallinn\0"
+    "Africa/Cairo\0"
+    "Africa/El_Aaiun\0"
+    "Africa/Asmara\0"
+    "Europe/Madrid\0"
+    "Africa/Ceuta\0"
+    "Atlantic/Canary\0"
+    "Africa/Addis_Ababa\0"
+    "Europe/Helsinki\0"
+    "Pacific/Fiji\0"
+    "Atlantic/Stanley\0"
+    "Pacific/Chuuk\0"
+    "Pacific/Pohnpei\0"
+    "Pacific/Kosrae\0"
+    "Atlantic/Faroe\0"
+    "Europe/Paris\0"
+    "Africa/Libreville\0"
+    "Europe/London\0"
+    "America/Grenada\0"
+    "Asia/Tbilisi\0"
+    "America/Cayenne\0"
+    "Europe/Guernsey\0"
+    "Africa/Accra\0"
+    "Europe/Gibraltar\0"
+    "America/Nuuk\0"
+    "America/Danmarkshavn\0"
+    "America/Scoresbysund\0"
+    "America/Thule\0"
+    "Africa/Banjul\0"
+    "Africa/Conakry\0"
+    "America/Guadeloupe\0"
+    "Africa/Malabo\0"
+    "Europe/Athens\0"
+    "Atlantic/South_Georgia\0"
+    "America/Guatemala\0"
+    "Pacific/Guam\0"
+    "Africa/Bissau\0"
+    "America/Guyana\0"
+    "Asia/Hong_Kong\0"
+    "America/Tegucigalpa\0"
+    "Europe/Zagreb\0"
+    "America/Port-au-Prince\0"
+    "Europe/Budapest\0"
+    "Asia/Jakarta\0"
+    "Asia/Pontianak\0"
+    "Asia/Makassar\0"
+    "Asia/Jayapura\0"
+    "Europe/Dublin\0"
+    "Asia/Jerusalem\0"
+    "Europe/Isle_of_Man\0"
+    "Asia/Kolkata\0"
+    "Indian/Chagos\0"
+    "Asia/Baghdad\0"
+    "Asia/Tehran\0"
+    "Atlantic/Reykjavik\0"
+    "Europe/Rome\0"
+    "Europe/Jersey\0"
+    "America/Jamaica\0"
+    "Asia/Amman\0"
+    "Asia/Tokyo\0"
+    "Africa/Nairobi\0"
+    "Asia/Bishkek\0"
+    "Asia/Phnom_Penh\0"
+    "Pacific/Tarawa\0"
+    "Pacific/Enderbury\0"
+    "Pacific/Kiritimati\0"
+    "Indian/Comoro\0"
+    "America/St_Kitts\0"
+    "Asia/Pyongyang\0"
+    "Asia/Seoul\0"
+    "Asia/Kuwait\0"
+    "America/Cayman\0"
+    "Asia/Almaty\0"
+    "Asia/Qyzylorda\0"
+    "Asia/Qostanay\0"
+    "Asia/Aqtobe\0"
+    "Asia/Aqtau\0"
+    "Asia/Atyrau\0"
+    "Asia/Oral\0"
+    "Asia/Vientiane\0"
+    "Asia/Beirut\0"
+    "America/St_Lucia\0"
+    "Europe/Vaduz\0"
+    "Asia/Colombo\0"
+    "Africa/Monrovia\0"
+    "Africa/Maseru\0"
+    "Europe/Vilnius\0"
+    "Europe/Luxembourg\0"
+    "Europe/Riga\0"
+    "Africa/Tripoli\0"
+    "Africa/Casablanca\0"
+    "Europe/Monaco\0"
+    "Europe/Chisinau\0"
+    "Europe/Podgorica\0"
+    "America/Marigot\0"
+    "Indian/Antananarivo\0"
+    "Pacific/Majuro\0"
+    "Pacific/Kwajalein\0"
+    "Europe/Skopje\0"
+    "Africa/Bamako\0"
+    "Asia/Yangon\0"
+    "Asia/Ulaanbaatar\0"
+    "Asia/Hovd\0"
+    "Asia/Choibalsan\0"
+    "Asia/Macau\0"
+    "Pacific/Saipan\0"
+    "America/Martinique\0"
+    "Africa/Nouakchott\0"
+    "America/Montserrat\0"
+    "Europe/Malta\0"
+    "Indian/Mauritius\0"
+    "Indian/Maldives\0"
+    "Africa/Blantyre\0"
+    "America/Mexico_City\0"
+    "America/Cancun\0"
+    "America/Merida\0"
+    "America/Monterrey\0"
+    "America/Matamoros\0"
+    "America/Mazatlan\0"
+    "America/Chihuahua\0"
+    "America/Ojinaga\0"
+    "America/Hermosillo\0"
+    "America/Tijuana\0"
+    "America/Bahia_Banderas\0"
+    "Asia/Kuala_Lumpur\0"
+    "Asia/Kuching\0"
+    "Africa/Maputo\0"
+    "Africa/Windhoek\0"
+    "Pacific/Noumea\0"
+    "Africa/Niamey\0"
+    "Pacific/Norfolk\0"
+    "Africa/Lagos\0"
+    "America/Managua\0"
+    "Europe/Amsterdam\0"
+    "Europe/Oslo\0"
+    "Asia/Kathmandu\0"
+    "Pacific/Nauru\0"
+    "Pacific/Niue\0"
+    "Pacific/Auckland\0"
+    "Pacific/Chatham\0"
+    "Asia/Muscat\0"
+    "America/Panama\0"
+    "America/Lima\0"
+    "Pacific/Tahiti\0"
+    "Pacific/Marquesas\0"
+    "Pacific/Gambier\0"
+    "Pacific/Port_Moresby\0"
+    "Pacific/Bougainville\0"
+    "Asia/Manila\0"
+    "Asia/Karachi\0"
+    "Europe/Warsaw\0"
+    "America/Miquelon\0"
+    "Pacific/Pitcairn\0"
+    "America/Puerto_Rico\0"
+    "Asia/Gaza\0"
+    "Asia/Hebron\0"
+    "Europe/Lisbon\0"
+    "Atlantic/Madeira\0"
+    "Atlantic/Azores\0"
+    "Pacific/Palau\0"
+    "America/Asuncion\0"
+    "Asia/Qatar\0"
+    "Indian/Reunion\0"
+    "Europe/Bucharest\0"
+    "Europe/Belgrade\0"
+    "Europe/Kaliningrad\0"
+    "Europe/Moscow\0"
+    "Europe/Simferopol\0"
+    "Europe/Kirov\0"
+    "Europe/Astrakhan\0"
+    "Europe/Volgograd\0"
+    "Europe/Saratov\0"
+    "Europe/Ulyanovsk\0"
+    "Europe/Samara\0"
+    "Asia/Yekaterinburg\0"
+    "Asia/Omsk\0"
+    "Asia/Novosibirsk\0"
+    "Asia/Barnaul\0"
+    "Asia/Tomsk\0"
+    "Asia/Novokuznetsk\0"
+    "Asia/Krasnoyarsk\0"
+    "Asia/Irkutsk\0"
+    "Asia/Chita\0"
+    "Asia/Yakutsk\0"
+    "Asia/Khandyga\0"
+    "Asia/Vladivostok\0"
+    "Asia/Ust-Nera\0"
+    "Asia/Magadan\0"
+    "Asia/Sakhalin\0"
+    "Asia/Srednekolymsk\0"
+    "Asia/Kamchatka\0"
+    "Asia/Anadyr\0"
+    "Africa/Kigali\0"
+    "Asia/Riyadh\0"
+    "Pacific/Guadalcanal\0"
+    "Indian/Mahe\0"
+    "Africa/Khartoum\0"
+    "Europe/Stockholm\0"
+    "Asia/Singapore\0"
+    "Atlantic/St_Helena\0"
+    "Europe/Ljubljana\0"
+    "Arctic/Longyearbyen\0"
+    "Europe/Bratislava\0"
+    "Africa/Freetown\0"
+    "Europe/San_Marino\0"
+    "Africa/Dakar\0"
+    "Africa/Mogadishu\0"
+    "America/Paramaribo\0"
+    "Africa/Juba\0"
+    "Africa/Sao_Tome\0"
+    "America/El_Salvador\0"
+    "America/Lower_Princes\0"
+    "Asia/Damascus\0"
+    "Africa/Mbabane\0"
+    "America/Grand_Turk\0"
+    "Africa/Ndjamena\0"
+    "Indian/Kerguelen\0"
+    "Africa/Lome\0"
+    "Asia/Bangkok\0"
+    "Asia/Dushanbe\0"
+    "Pacific/Fakaofo\0"
+    "Asia/Dili\0"
+    "Asia/Ashgabat\0"
+    "Africa/Tunis\0"
+    "Pacific/Tongatapu\0"
+    "Europe/Istanbul\0"
+    "America/Port_of_Spain\0"
+    "Pacific/Funafuti\0"
+    "Asia/Taipei\0"
+    "Africa/Dar_es_Salaam\0"
+    "Europe/Kiev\0"
+    "Europe/Uzhgorod\0"
+    "Europe/Zaporozhye\0"
+    "Africa/Kampala\0"
+    "Pacific/Midway\0"
+    "Pacific/Wake\0"
+    "America/New_York\0"
+    "America/Detroit\0"
+    "America/Kentucky/Louisville\0"
+    "America/Kentucky/Monticello\0"
+    "America/Indiana/Indianapolis\0"
+    "America/Indiana/Vincennes\0"
+    "America/Indiana/Winamac\0"
+    "America/Indiana/Marengo\0"
+    "America/Indiana/Petersburg\0"
+    "America/Indiana/Vevay\0"
+    "America/Chicago\0"
+    "America/Indiana/Tell_City\0"
+    "America/Indiana/Knox\0"
+    "America/Menominee\0"
+    "America/North_Dakota/Center\0"
+    "America/North_Dakota/New_Salem\0"
+    "America/North_Dakota/Beulah\0"
+    "America/Denver\0"
+    "America/Boise\0"
+    "America/Phoenix\0"
+    "America/Los_Angeles\0"
+    "America/Anchorage\0"
+    "America/Juneau\0"
+    "America/Sitka\0"
+    "America/Metlakatla\0"
+    "America/Yakutat\0"
+    "America/Nome\0"
+    "America/Adak\0"
+    "Pacific/Honolulu\0"
+    "America/Montevideo\0"
+    "Asia/Samarkand\0"
+    "Asia/Tashkent\0"
+    "Europe/Vatican\0"
+    "America/St_Vincent\0"
+    "America/Caracas\0"
+    "America/Tortola\0"
+    "America/St_Thomas\0"
+    "Asia/Ho_Chi_Minh\0"
+    "Pacific/Efate\0"
+    "Pacific/Wallis\0"
+    "Pacific/Apia\0"
+    "Asia/Aden\0"
+    "Indian/Mayotte\0"
+    "Africa/Johannesburg\0"
+    "Africa/Lusaka\0"
+    "Africa/Harare\0";
+static constexpr uint16_t TimeZoneNameOffsets[] = {
+    0, 8, 23, 34, 45, 61, 78, 92, 105, 119, 138, 155, 172, 198, 216, 234,
+    253, 270, 287, 305, 336, 362, 386, 410, 436, 464, 491, 518, 544, 571, 602, 628,
+    646, 660, 680, 701, 718, 735, 755, 772, 794, 813, 832, 851, 868, 884, 900, 914,
+    931, 941, 957, 974, 985, 1001, 1020, 1033, 1046, 1063, 1081, 1103, 1120, 1132, 1147, 1166,
+    1182, 1196, 1214, 1229, 1247, 1262, 1276, 1294, 1315, 1330, 1347, 1367, 1385, 1400, 1417, 1436,
+    1451, 1464, 1480, 1493, 1508, 1525, 1541, 1559, 1575, 1593, 1614, 1630, 1646, 1666, 1682, 1702,
+    1719, 1736, 1756, 1773, 1794, 1809, 1831, 1848, 1870, 1890, 1905, 1921, 1942, 1962, 1980, 1999,
+    2014, 2027, 2043, 2061, 2075, 2094, 2108, 2123, 2141, 2158, 2179, 2194, 2208, 2222, 2234, 2249,
+    2268, 2283, 2303, 2319, 2336, 2349, 2364, 2378, 2392, 2408, 2424, 2442, 2459, 2481, 2496, 2514,
+    2532, 2547, 2560, 2576, 2590, 2604, 2617, 2633, 2652, 2668, 2681, 2698, 2712, 2728, 2743, 2758,
+    2771, 2789, 2803, 2819, 2832, 2848, 2864, 2877, 2894, 2907, 2928, 2949, 2963, 2977, 2992, 3011,
+    3025, 3039, 3062, 3080, 3093, 3107, 3122, 3137, 3157, 3171, 3194, 3210, 3223, 3238, 3252, 3266,
+    3280, 3295, 3314, 3327, 3341, 3354, 3366, 3385, 3397, 3411, 3427, 3438, 3449, 3464, 3477, 3493,
+    3508, 3526, 3545, 3559, 3576, 3591, 3602, 3614, 3629, 3641, 3656, 3670, 3682, 3693, 3705, 3715,
+    3730, 3742, 3759, 3772, 3785, 3801, 3815, 3830, 3848, 3860, 3875, 3893, 3907, 3923, 3940, 3956,
+    3976, 3991, 4009, 4023, 4037, 4049, 4066, 4076, 4092, 4103, 4118, 4137, 4155, 4174, 4187, 4204,
+    4220, 4236, 4256, 4271, 4286, 4304, 4322, 4339, 4357, 4373, 4392, 4408, 4431, 4449, 4462, 4476,
+    4492, 4507, 4521, 4537, 4550, 4566, 4583, 4595, 4610, 4624, 4637, 4654, 4670, 4682, 4697, 4710,
+    4725, 4743, 4759, 4780, 4801, 4813, 4826, 4840, 4857, 4874, 4894, 4904, 4916, 4930, 4947, 4963,
+    4977, 4994, 5005, 5020, 5037, 5053, 5072, 5086, 5104, 5117, 5134, 5151, 5166, 5183, 5197, 5216,
+    5226, 5243, 5256, 5267, 5285, 5302, 5315, 5326, 5339, 5353, 5370, 5384, 5397, 5411, 5430, 5445,
+    5457, 5471, 5483, 5503, 5515, 5531, 5548, 5563, 5582, 5599, 5619, 5637, 5653, 5671, 5684, 5701,
+    5720, 5732, 5748, 5768, 5790, 5804, 5819, 5838, 5854, 5871, 5883, 5896, 5910, 5926, 5936, 5950,
+    5963, 5981, 5997, 6019, 6036, 6048, 6069, 6081, 6097, 6115, 6130, 6145, 6158, 6175, 6191, 6219,
+    6247, 6276, 6302, 6326, 6350, 6377, 6399, 6415, 6441, 6462, 6480, 6508, 6539, 6567, 6582, 6596,
+    6612, 6632, 6650, 6665, 6679, 6698, 6714, 6727, 6740, 6757, 6776, 6791, 6805, 6820, 6839, 6855,
+    6871, 6889, 6906, 6920, 6935, 6948, 6958, 6973, 6993, 7007, 7021
+};
+static constexpr int16_t TimeZoneHashSeeds[] = {
+    2, 0, -423, -420, -419, 1, 1, 0, 3, 0, -418, 0, 0, 1, -417, 0,
+    0, -415, 3, 6, 0, -414, 0, -413, 6, 0, 0, 5, 0, 3, 4, 0,
+    -412, -411, -407, -397, 4, -396, -395, -390, 1, -389, 0, 1, -388, 0, 0, -384,
+    0, 0, 0, 0, -382, -381, 0, 0, -378, -370, 0, 0, 1, 0, 0, 1,
+    0, 0, 0, -366, 2, 8, -364, 0, -358, 0, 0, 0, -357, 0, 1, 0,
+    1, 1, 3, -352, 0, 0, -351, 0, 1, -347, 0, 0, -346, 0, -344, 2,
+    -343, 1, -338, -336, -334, 3, 4, 8, 3, 0, -333, -332, 1, 1, 2, 0,
+    3, 0, 0, -327, 0, 0, -326, 0, -325, 0, -322, 2, -321, 0, 0, -319,
+    0, 0, -318, -316, -314, -309, -304, 0, 0, 0, -303, 0, 0, -301, 1, 6,
+    0, -300, 0, 0, 0, 0, 0, 0, -298, -292, 0, 5, 0, -286, -285, -284,
+    0, -283, -278, -276, -275, -272, -270, -268, -262, -259, 0, 0, 2, 0, 0, 1,
+    -254, 0, 1, -253, 1, -251, -245, 0, 0, 1, -242, 0, 0, 0, 0, 1,
+    -239, 5, 2, 3, 0, 0, -234, -231, 1, -229, 0, -227, -224, 0, 0, 6,
+    -223, 0, -222, 2, 1, 0, 2, -221, -220, 1, 0, 0, 0, -216, -215, -214,
+    1, 0, 0, 1, 0, -213, 0, 0, 0, -211, -208, 0, -207, 0, 8, 0,
+    -206, -196, -193, 0, 0, 0, -191, 1, 0, 0, -190, 3, -189, 0, -188, -187,
+    6, 2, -186, 3, 2, -183, 0, 2, 0, 0, 0, 0, -179, -178, 0, 1,
+    0, -174, 1, -172, 7, 0, 0, 0, -170, 3, -169, 1, -165, 2, 4, -163,
+    -162, 0, 3, -158, -157, -149, 3, 0, -148, 0, -147, 0, -145, 1, 0, 0,
+    0, 0, -142, 3, 0, -141, -135, 4, -133, 1, -132, -120, 0, 4, 0, 1,
+    -117, -110, -108, 0, 0, -102, 0, -101, 0, -99, 6, -98, -95, -94, 2, -91,
+    1, 4, -88, 5, 4, -87, -86, 0, 1, -84, 0, 2, -81, 2, 3, 0,
+    0, -80, 0, 6, 0, -77, 0, 0, -76, 2, -75, 0, -70, 1, 1, -67,
+    0, 3, 0, 0, 0, 1, 1, 0, 0, -66, -65, 2, 5, -61, -60, 0,
+    0, 9, -57, -55, 1, 3, 5, 0, 0, 0, -51, -46, -45, -40, 4, 0,
+    -39, -38, 0, 0, -34, 1, 0, 20, -33, -24, 14, -14, 14, 11, 0, 0,
+    0, 8, 0, 0, 0, 0, -10, -9, -7, 2
+};
+static constexpr uint16_t TimeZoneHashSlots[] = {
+    366, 365, 344, 347, 22, 201, 182, 193, 207, 394, 118, 237, 133, 383, 185, 219,
+    260, 370, 122, 262, 230, 208, 203, 121, 99, 298, 155, 123, 56, 82, 1, 276,
+    282, 78, 265, 283, 95, 49, 191, 330, 41, 46, 19, 146, 378, 399, 84, 48,
+    403, 125, 277, 279, 331, 391, 332, 235, 400, 130, 386, 418, 256, 16, 154, 148,
+    202, 90, 343, 251, 377, 287, 393, 88, 159, 408, 280, 398, 362, 259, 93, 25,
+    354, 335, 241, 101, 374, 226, 136, 389, 315, 409, 42, 109, 319, 349, 183, 414,
+    92, 164, 196, 53, 223, 243, 85, 411, 323, 59, 402, 364, 171, 297, 233, 160,
+    261, 358, 346, 361, 166, 250, 325, 147, 158, 131, 407, 341, 310, 242, 65, 285,
+    320, 87, 70, 129, 66, 385, 149, 30, 179, 50, 360, 29, 72, 412, 213, 153,
+    143, 170, 342, 352, 406, 272, 424, 115, 113, 381, 321, 372, 380, 337, 317, 120,
+    224, 18, 253, 404, 254, 295, 312, 363, 322, 268, 273, 57, 425, 80, 134, 281,
+    299, 353, 359, 144, 222, 267, 288, 124, 371, 216, 356, 169, 91, 397, 309, 40,
+    375, 94, 26, 58, 284, 81, 76, 192, 173, 5, 246, 83, 2, 245, 165, 162,
+    229, 231, 296, 172, 217, 415, 339, 294, 180, 24, 69, 35, 234, 324, 47, 161,
+    108, 311, 15, 211, 215, 351, 333, 392, 75, 119, 10, 206, 291, 209, 89, 54,
+    45, 195, 239, 184, 142, 387, 232, 112, 43, 9, 86, 244, 23, 225, 316, 382,
+    31, 388, 96, 139, 60, 27, 100, 306, 178, 410, 39, 67, 338, 275, 345, 13,
+    176, 270, 110, 174, 355, 111, 73, 11, 33, 114, 194, 44, 156, 32, 74, 36,
+    6, 413, 367, 240, 17, 20, 300, 286, 135, 357, 21, 313, 264, 163, 368, 177,
+    328, 128, 228, 197, 104, 329, 249, 200, 218, 126, 150, 77, 14, 97, 252, 190,
+    106, 266, 303, 289, 28, 422, 37, 301, 51, 340, 198, 63, 145, 236, 278, 98,
+    423, 401, 79, 257, 71, 12, 187, 34, 334, 38, 376, 417, 290, 212, 68, 8,
+    227, 105, 181, 416, 210, 186, 140, 132, 292, 274, 305, 304, 167, 107, 188, 384,
+    55, 61, 248, 314, 137, 7, 336, 62, 247, 396, 293, 327, 269, 373, 205, 151,
+    348, 4, 379, 255, 3, 152, 116, 0, 127, 390, 302, 117, 64, 318, 263, 52,
+    271, 189, 141, 103, 199, 421, 369, 221, 405, 238, 307, 157, 168, 350, 326, 220,
+    175, 138, 420, 214, 204, 419, 258, 308, 102, 395
 };
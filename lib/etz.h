@@ -4,22 +4,46 @@
 
 //-----------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
 #include <algorithm>
-#include <cstdarg>
+#include <array>
 #include <cstdint>
 #include <ctime>
+#include <limits>
 #include <string>
-#include <unordered_map>
+#include <string_view>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#endif
+#ifdef _MSC_VER
+#include <xmmintrin.h>
+#endif
 
 
 //-----------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
 namespace ETZ
 {
 
-// Cache delivers best results for common use case (repetitive queries for the same time zone and an incrementing time parameter).
+// Cache delivers best results for common use case (repetitive queries for the same time zone and a time parameter that stays between two transitions).
 // When query parameters are less consistent, performance may be improved by disabling the cache...
 //
 static constexpr bool EnableRuleCache = true; 
 
+// Number of time zones the per-thread rule cache holds at once. Workloads that interleave queries for several time zones on the same thread
+// should use at least as many entries as time zones in rotation...
+//
+static constexpr size_t RuleCacheSize = 16;
+
+// Stores time zone rules in 4 bytes each rather than 8 (see UTC::compactIntervalLu), for builds where the size of read-only data matters more
+// than lookup speed. Defining ETZ_COMPACT_RULES as 1 enables it without editing this file, test/CMakeLists.txt builds etz-test-compact so to
+// compare the two (etz-test bench vs etz-test-compact bench)...
+//
+#ifndef ETZ_COMPACT_RULES
+#define ETZ_COMPACT_RULES 0
+#endif
+static constexpr bool EnableCompactRules = ETZ_COMPACT_RULES;
+
 
 //-----------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
 // time_t is only a long on some platforms - we require long long for many of the rules...
@@ -27,54 +51,249 @@ static constexpr bool EnableRuleCache = true;
 using TimeT = long long;
 
 
+//-----------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+// Proleptic Gregorian calendar arithmetic, no libc and no tables (algorithms from http://howardhinnant.github.io/date_algorithms.html).
+//
+class Civil
+{
+public:
+    static constexpr TimeT SecondsPerDay = 86400;
+    static constexpr TimeT SecondsPerYear = 31556952; // mean Gregorian year (365.2425 days)
+
+    // Times whose year fits in Date::year, civilFromDays wraps the years of others...
+    static constexpr TimeT MinTime = -67768100567971200; // -2147483648-01-01T00:00:00
+    static constexpr TimeT MaxTime = 67767976233532799; // 2147483647-12-31T23:59:59
+
+    static constexpr bool isLeap(const int32_t year) { return year % 4 == 0 && (year % 100 != 0 || year % 400 == 0); }
+    static constexpr uint32_t daysInMonth(const int32_t year, const uint32_t month) { return month == 2 ? (isLeap(year) ? 29 : 28) : 30 + ((month + month / 8) & 1); }
+
+    // Days since 1970-01-01 for year/month [1,12]/day [1,31]...
+    static constexpr TimeT daysFromCivil(int32_t year, const uint32_t month, const uint32_t day)
+    {
+        year -= month <= 2;
+        const auto era = (year >= 0 ? year : year - 399) / 400;
+        const auto yoe = static_cast<uint32_t>(year - era * 400); // [0, 399]
+        const auto doy = (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 + day - 1; // [0, 365]
+        const auto doe = yoe * 365 + yoe / 4 - yoe / 100 + doy; // [0, 146096]
+        return static_cast<TimeT>(era) * 146097 + static_cast<TimeT>(doe) - 719468;
+    }
+
+    struct Date {
+        int32_t year {};
+        uint32_t month {}; // [1, 12]
+        uint32_t day {}; // [1, 31]
+    };
+
+    // Inverse of daysFromCivil...
+    static constexpr Date civilFromDays(TimeT days)
+    {
+        days += 719468;
+        const auto era = (days >= 0 ? days : days - 146096) / 146097;
+        const auto doe = static_cast<uint32_t>(days - era * 146097); // [0, 146096]
+        const auto yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365; // [0, 399]
+        const auto doy = doe - (365 * yoe + yoe / 4 - yoe / 100); // [0, 365]
+        const auto mp = (5 * doy + 2) / 153; // [0, 11]
+        const auto month = mp < 10 ? mp + 3 : mp - 9;
+        return { static_cast<int32_t>(static_cast<TimeT>(yoe) + era * 400 + (month <= 2)), month, doy - (153 * mp + 2) / 5 + 1 };
+    }
+
+    // Day of the week for days since 1970-01-01, [0, 6] from Sunday (as std::tm::tm_wday)...
+    static constexpr uint32_t weekday(const TimeT days) { return static_cast<uint32_t>(((days + 4) % 7 + 7) % 7); }
+
+    // Splits a time into whole days since 1970-01-01 and seconds into that day, rounding towards negative infinity...
+    static constexpr TimeT days(const TimeT time) { return (time >= 0 ? time : time - (SecondsPerDay - 1)) / SecondsPerDay; }
+    static constexpr uint32_t secondsOfDay(const TimeT time) { return static_cast<uint32_t>(time - days(time) * SecondsPerDay); }
+
+    // Structure of arrays output for decompose(), each column must have room for count values...
+    struct Columns {
+        int32_t* year {};
+        uint8_t* month {}; // [1, 12]
+        uint8_t* day {}; // [1, 31]
+        uint8_t* hour {}; // [0, 23]
+        uint8_t* minute {}; // [0, 59]
+        uint8_t* second {}; // [0, 59]
+        uint8_t* weekday {}; // [0, 6] from Sunday
+    };
+
+    // Batch split of (local) times into calendar field columns, for times within roughly a million years of 1970. Times are reduced to blocks
+    // of days (shifted by a whole number of 400 year eras to keep them positive) and seconds of the day, then the calendar arithmetic runs
+    // branch free on unsigned 32 bit lanes and each column is written by its own loop, so the compiler can vectorize everything after the
+    // 64 bit reduction...
+    //
+    static void decompose(const TimeT* times, const size_t count, const Columns& columns)
+    {
+        static constexpr size_t Block = 256;
+        static constexpr uint32_t Eras = 4096;
+        static constexpr uint32_t Shift = 719468 + Eras * 146097; // days from 0000-03-01, Eras before, to 1970-01-01
+
+        uint32_t days[Block];
+        uint32_t seconds[Block];
+        uint32_t years[Block];
+        uint32_t months[Block];
+        uint32_t monthDays[Block];
+        // Byte stores could alias columns itself, so take copies of the pointers...
+        auto* const month = columns.month;
+        auto* const day = columns.day;
+        auto* const hour = columns.hour;
+        auto* const minute = columns.minute;
+        auto* const second = columns.second;
+        auto* const weekday = columns.weekday;
+        for (size_t i = 0; i < count; i += Block) {
+            const auto n = std::min(Block, count - i);
+            for (size_t j = 0; j < n; ++j) {
+                const auto d = Civil::days(times[i + j]);
+                days[j] = static_cast<uint32_t>(d + Shift);
+                seconds[j] = static_cast<uint32_t>(times[i + j] - d * SecondsPerDay);
+            }
+            for (size_t j = 0; j < n; ++j) {
+                const auto era = days[j] / 146097;
+                const auto doe = days[j] - era * 146097; // [0, 146096]
+                const auto yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365; // [0, 399]
+                const auto doy = doe - (365 * yoe + yoe / 4 - yoe / 100); // [0, 365]
+                const auto mp = (5 * doy + 2) / 153; // [0, 11]
+                months[j] = mp + 3 - 12 * (mp >= 10);
+                years[j] = yoe + era * 400 + (months[j] <= 2);
+                monthDays[j] = doy - (153 * mp + 2) / 5 + 1;
+            }
+            for (size_t j = 0; j < n; ++j) {
+                columns.year[i + j] = static_cast<int32_t>(years[j]) - static_cast<int32_t>(Eras * 400);
+            }
+            for (size_t j = 0; j < n; ++j) {
+                month[i + j] = static_cast<uint8_t>(months[j]);
+            }
+            for (size_t j = 0; j < n; ++j) {
+                day[i + j] = static_cast<uint8_t>(monthDays[j]);
+            }
+            for (size_t j = 0; j < n; ++j) {
+                hour[i + j] = static_cast<uint8_t>(seconds[j] / 3600);
+            }
+            for (size_t j = 0; j < n; ++j) {
+                minute[i + j] = static_cast<uint8_t>(seconds[j] / 60 % 60);
+            }
+            for (size_t j = 0; j < n; ++j) {
+                second[i + j] = static_cast<uint8_t>(seconds[j] % 60);
+            }
+            for (size_t j = 0; j < n; ++j) {
+                weekday[i + j] = static_cast<uint8_t>((days[j] + 3) % 7); // (days + 4) % 7 before the shift, which is 1 (mod 7)
+            }
+        }
+    }
+};
+
+
 //-----------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
 // Enums.
 //
 #include "etz-data/abbreviation-enum.inl"
 #include "etz-data/timezone-enum.inl"
+#include "etz-data/country-enum.inl"
 
 
 //-----------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
 // Packed rule structure. 8 bytes per rule for all architecture word sizes.
+// Rules are ordered by key(), which preserves the order of timeStart, so searches compare keys directly and only decode the matched rule...
 //
 class Rule
 {
-    template <class T> constexpr T abs(const T x) { return x < 0 ? -x : x; }
+    static constexpr TimeT KeyMin = std::numeric_limits<int32_t>::min();
+    static constexpr TimeT KeyMax = std::numeric_limits<int32_t>::max();
+    static constexpr int32_t OffsetBias = 0x10000;
 
 public:
     constexpr Rule() = default;
+    constexpr Rule(const int32_t key, const uint32_t data)
+        : m_key(key)
+        , m_data(data)
+    {
+    }
     constexpr Rule(const TimeT timeStart, const Abbreviation abbreviation, const int32_t gmtOffset, const bool isDST)
-        : m_timeStart(static_cast<uint32_t>(abs(timeStart))) // [-4260212373,16720524000]
-        , m_gmtOffset(static_cast<uint16_t>(abs(gmtOffset))) // [-57360,54822]
-        , m_data(static_cast<uint16_t>(abbreviation) << 6 | isDST << 5 | (gmtOffset < 1) << 4 | (timeStart < 1) << 3 | static_cast<uint16_t>(abs(timeStart) >> 32))
+        : Rule(key(timeStart), data(timeStart, abbreviation, gmtOffset, isDST))
+    {
+    }
+
+    // Times outside this range share the key of the nearest end...
+    static constexpr TimeT MinTime = KeyMin * 16;
+    static constexpr TimeT MaxTime = KeyMax * 16 + 15;
+
+    // Encodes a time for comparison against key(). Times sharing a key with a rule may still precede it, see UTC::search...
+    static constexpr int32_t key(const TimeT time)
     {
+        const auto clamped = time < MinTime ? MinTime : time > MaxTime ? MaxTime : time;
+        return static_cast<int32_t>(clamped >> 4); // arithmetic shift rounds down
+    }
+
+    // Encodes everything but the key, rules are stored as parallel arrays of key() and data() (see RulesBase::RulesType)...
+    static constexpr uint32_t data(const TimeT timeStart, const Abbreviation abbreviation, const int32_t gmtOffset, const bool isDST)
+    {
+        return static_cast<uint32_t>(timeStart - static_cast<TimeT>(key(timeStart)) * 16) << 28 // [-4260212373,16720524000]
+            | static_cast<uint32_t>(abbreviation) << 18 | isDST << 17 | static_cast<uint32_t>(gmtOffset + OffsetBias); // [-57360,54822]
     }
 
     constexpr bool isValid() const { return m_data != 0; } // the lowest valid Abbreviation ordinal is > 0
-    constexpr TimeT timeStart() const { return (m_data & 0x08) ? -((static_cast<TimeT>(m_data & 0x07) << 32) + m_timeStart) : ((static_cast<TimeT>(m_data & 0x07) << 32) + m_timeStart); }
-    constexpr Abbreviation abbreviation() const { return Abbreviation(m_data >> 6); }
-    constexpr int32_t gmtOffset() const { return (m_data & 0x10) ? -static_cast<int32_t>(m_gmtOffset) : m_gmtOffset; }
-    constexpr bool isDST() const { return m_data & 0x20; }
+    constexpr int32_t key() const { return m_key; }
+    constexpr TimeT timeStart() const { return static_cast<TimeT>(m_key) * 16 + (m_data >> 28); }
+    constexpr Abbreviation abbreviation() const { return Abbreviation((m_data >> 18) & 0x1ff); }
+    constexpr int32_t gmtOffset() const { return static_cast<int32_t>(m_data & 0x1ffff) - OffsetBias; }
+    constexpr bool isDST() const { return m_data & 0x20000; }
 
 private:
-    uint32_t m_timeStart {};
-    uint16_t m_gmtOffset {};
+    // timeStart / 16 rounded down, this allows for timeStart values in [-34359738368,34359738367], we only require [-4260212373,16720524000].
+    // This schema supports timeStart values into the year 3058
+    //
+    int32_t m_key {};
 
     /**
-    *  1
-    *  5------7------0
-    *  ^^^^^^^^^        abbreviation  | 9 bits | [0,316]
-    *           ^       isDST         | 1 bit  |
-    *            ^      gmtOffsetSign | 1 bit  |
-    *             ^     timeStartSign | 1 bit  |
-    *              ^^^  timeStart32   | 3 bits | Bits 32, 33 and 34 from timeStart
-                                      | Combined with timeStartSign this allows for [-34359738367,34359738367], we only require [-4260212373,16720524000]
-                                      | This schema supports timeStart values into the year 3058
+    *  3
+    *  1------------------------------0
+    *  ^^^^                              timeStart4    | 4 bits  | timeStart - key * 16
+    *      ^                             (unused)      | 1 bit   |
+    *       ^^^^^^^^^                    abbreviation  | 9 bits  | [0,316]
+    *                ^                   isDST         | 1 bit   |
+    *                 ^^^^^^^^^^^^^^^^^  gmtOffset     | 17 bits | Biased by 65536, allows for [-65536,65535]
     */
-    uint16_t m_data {};
+    uint32_t m_data {};
 };
 
 static_assert(sizeof(Rule) == 8);
+static_assert(RuleCacheSize > 0);
+
+
+//-----------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+// Broken-down local date/time, as returned by UTC::toLocalFields.
+//
+struct LocalDateTime
+{
+    constexpr LocalDateTime() = default;
+    constexpr LocalDateTime(const TimeT local, const Rule& rule)
+    {
+        const auto days = Civil::days(local);
+        const auto date = Civil::civilFromDays(days);
+        const auto seconds = Civil::secondsOfDay(local);
+        year = date.year;
+        month = static_cast<uint8_t>(date.month);
+        day = static_cast<uint8_t>(date.day);
+        hour = static_cast<uint8_t>(seconds / 3600);
+        minute = static_cast<uint8_t>(seconds / 60 % 60);
+        second = static_cast<uint8_t>(seconds % 60);
+        weekday = static_cast<uint8_t>(Civil::weekday(days));
+        yearDay = static_cast<uint16_t>(days - Civil::daysFromCivil(date.year, 1, 1));
+        gmtOffset = rule.gmtOffset();
+        isDST = rule.isDST();
+        abbreviation = rule.abbreviation();
+    }
+
+    int32_t year {};
+    uint8_t month {}; // [1, 12]
+    uint8_t day {}; // [1, 31]
+    uint8_t hour {}; // [0, 23]
+    uint8_t minute {}; // [0, 59]
+    uint8_t second {}; // [0, 59]
+    uint8_t weekday {}; // [0, 6] from Sunday
+    uint16_t yearDay {}; // [0, 365] from 1st January
+    int32_t gmtOffset {}; // seconds
+    bool isDST {};
+    Abbreviation abbreviation { Abbreviation::Invalid };
+};
 
 
 //-----------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
@@ -84,8 +303,80 @@ class RulesBase {
 protected:
     // Declare members in ancestor class - clang/gcc require members used in constant expressions to be in a complete class (https://stackoverflow.com/a/29662526)...
     //
-    using RulesType = std::pair<const Rule*, uint16_t>;
-    template <typename T, size_t N> static constexpr auto Rules(T (&r)[N]) { return std::make_pair(r, static_cast<uint16_t>(N)); }
+    // How a time zone's rules are looked up, chosen per time zone by data/create-includes.py...
+    enum class Strategy : uint8_t {
+        Invalid,
+        Fixed, // a single rule, no search
+        Periodic, // two transitions recurring each year, evaluated arithmetically
+        Table, // searched, see UTC::search, then any recurrence beyond the last rule
+        Compact // as Table in 4 bytes per rule, see UTC::compactIntervalLu
+    };
+
+    // A transition recurring each year, on the first weekday on or after day of month (or the last weekday of month when day is 0) at a local
+    // time, that is the wall clock time of the offset in effect before it. The time may exceed a day, e.g. 24:00 on a Saturday...
+    //
+    struct Transition {
+        uint8_t month {}; // [1, 12]
+        uint8_t day {}; // [0, 31]
+        uint8_t weekday {}; // [0, 6] from Sunday
+        int32_t localSeconds {};
+        Abbreviation abbreviation {};
+        int32_t gmtOffset {};
+        bool isDST {};
+    };
+
+    // Both transitions fall within the same UTC calendar year, in the order given...
+    struct Recurrence {
+        Transition transitions[2];
+    };
+
+    // Compact entries are the time since the start of a year << PaletteBits | the palette index of the rest of the rule...
+    static constexpr uint32_t PaletteBits = 7;
+
+    // A time zone's rules as parallel arrays, keys apart from the rest of each rule so that searches stream only keys (16 to a cache line).
+    // years indexes the rule in effect at the start of each year (of Civil::SecondsPerYear, from 1970), from firstYear to the year of the last rule.
+    // Periodic time zones have a recurrence and a single rule, the first transition it gives, which as for tables also covers any earlier time.
+    // A table's recurrence continues it from its last rule, which is the first transition the recurrence gives, so the table need not list every
+    // future transition. Compact tables have no keys, data holds an entry per rule followed by a palette of the distinct Rule::data() of their rules.
+    // The rules of every time zone from some years before the data was generated are packed together (the hot arrays of etz-data/rules.inl), as
+    // nearly all queries fall within them. Earlier rules are a table of their own, history, which ends with the first of these...
+    //
+    struct RulesType {
+        Strategy strategy {};
+        const int32_t* keys {};
+        const uint32_t* data {};
+        const uint16_t* years {};
+        int32_t firstYear {};
+        uint16_t count {};
+        uint16_t countYears {};
+        const Recurrence* recurrence {};
+        const RulesType* history {};
+
+        constexpr Rule rule(const size_t i) const { return Rule(keys[i], data[i]); }
+        constexpr bool recurs(const int32_t key) const { return recurrence && key > keys[count - 1]; } // beyond the last rule of a table
+        constexpr bool searches(const int32_t key) const { return strategy == Strategy::Table && !recurs(key) && !(history && key <= keys[0]); }
+
+        // Whether utc precedes the first rule, so is looked up in history...
+        constexpr bool historic(const TimeT utc) const
+        {
+            return history && utc < (strategy == Strategy::Compact ? firstYear * Civil::SecondsPerYear + (data[0] >> PaletteBits) : rule(0).timeStart());
+        }
+    };
+    static constexpr auto Fixed(const int32_t* keys, const uint32_t* data) { return RulesType { Strategy::Fixed, keys, data, nullptr, 0, 1, 0 }; }
+    static constexpr auto Periodic(const int32_t* keys, const uint32_t* data, const Recurrence& recurrence)
+    {
+        return RulesType { Strategy::Periodic, keys, data, nullptr, 0, 1, 0, &recurrence };
+    }
+    static constexpr auto Table(const int32_t* keys, const uint32_t* data, const uint16_t count, const int32_t firstYear, const uint16_t* years, const uint16_t countYears,
+        const Recurrence* recurrence = nullptr, const RulesType* history = nullptr)
+    {
+        return RulesType { Strategy::Table, keys, data, years, firstYear, count, countYears, recurrence, history };
+    }
+    static constexpr auto Compact(const uint32_t* data, const uint16_t count, const int32_t firstYear, const uint16_t* years, const uint16_t countYears,
+        const Recurrence* recurrence = nullptr, const RulesType* history = nullptr)
+    {
+        return RulesType { Strategy::Compact, nullptr, data, years, firstYear, count, countYears, recurrence, history };
+    }
 };
 
 class UTC: public RulesBase
@@ -98,70 +389,488 @@ class UTC: public RulesBase
 #include "etz-data/rules.inl"
 
 public:
-    static constexpr size_t CountTimeZones = sizeof(TimeZoneRules) / sizeof(TimeZoneRules[0]);
-    using Map = std::unordered_map<TimeZone, const std::pair<const Rule*, uint16_t>*>;
+    static constexpr size_t CountTimeZones = sizeof(TimeZoneRules) / sizeof(TimeZoneRules[0]) - 1; // exclude TimeZone::Invalid
+    static_assert(CountTimeZones + 1 == static_cast<size_t>(TimeZone::_MAX), "TimeZoneRules must be indexed by TimeZone ordinal");
+    static_assert(sizeof(TimeZoneShares) / sizeof(TimeZoneShares[0]) == CountTimeZones + 1, "TimeZoneShares must be indexed by TimeZone ordinal");
+
+    // How UTC::fromLocal resolves local times that occur twice (overlaps, e.g. when DST ends) or not at all (gaps, e.g. when DST starts).
+    // Earliest and Latest pick the earlier or later of the two UTC times for an overlap, for a gap both return the UTC time of the transition...
+    //
+    enum class Policy : uint8_t {
+        Earliest,
+        Latest,
+        Reject
+    };
 
 private:
-    static auto ruleLu(const TimeZone timeZone, const TimeT utc)
+    // Offsets always differ by less than this, so a local time this far from both ends of an interval maps to exactly one UTC time...
+    static constexpr TimeT LocalMargin = 2 * 86400;
+
+    // A rule together with the span of time it covers, [start, end) - end being the next transition...
+    struct Interval {
+        TimeT start {};
+        TimeT end {};
+        Rule rule;
+
+        constexpr bool contains(const TimeT utc) const { return utc >= start && utc < end; }
+    };
+
+    static Interval intervalLu(const TimeZone timeZone, const TimeT utc)
     {
+        // Fully associative cache holding one interval per time zone, so queries either side of the last one hit. Time zone tags are kept
+        // apart from the intervals so the tag match is a single vectorizable pass, and victims are replaced round-robin. The most recently
+        // used slot is checked first so the common use case costs no more than a single entry cache. Time zones sharing rules share an entry,
+        // tagged with the first of them...
+        //
         thread_local static struct {
-            TimeZone timeZone { TimeZone::Invalid };
-            Rule rule;
-        } lastQuery;
+            TimeZone timeZones[RuleCacheSize] {};
+            Interval intervals[RuleCacheSize];
+            size_t victim {};
+            size_t last {};
+        } cache;
 
+        const auto shared = sharesLu(timeZone);
+        size_t slot = RuleCacheSize;
+        if constexpr (EnableRuleCache == true) {
+            if (cache.timeZones[cache.last] == shared && cache.intervals[cache.last].contains(utc)) {
+                return cache.intervals[cache.last];
+            }
+            for (size_t i = 0; i < RuleCacheSize; ++i) {
+                slot = cache.timeZones[i] == shared ? i : slot;
+            }
+            if (slot < RuleCacheSize && cache.intervals[slot].contains(utc)) {
+                cache.last = slot;
+                return cache.intervals[slot];
+            }
+        }
+        const auto* const rules = rulesLu(shared);
+        if (!rules) {
+            return Interval();
+        }
+        const auto interval = intervalLu(*rules, utc);
         if constexpr (EnableRuleCache == true) {
-            if (timeZone == lastQuery.timeZone && utc >= lastQuery.rule.timeStart()) {
-                return lastQuery.rule;
+            if (slot == RuleCacheSize) {
+                slot = cache.victim;
+                cache.victim = (cache.victim + 1) % RuleCacheSize;
+                cache.timeZones[slot] = shared;
             }
+            cache.intervals[slot] = interval;
+            cache.last = slot;
         }
-        const auto rules = TimeZoneRulesMap.find(timeZone);
-        if (rules == TimeZoneRulesMap.end()) {
-            return Rule();
+        return interval;
+    }
+
+    // The first time zone with the same rules (see TimeZoneShares), TimeZone::Invalid for unknown time zones...
+    static TimeZone sharesLu(const TimeZone timeZone)
+    {
+        const auto ordinal = static_cast<size_t>(timeZone);
+        return ordinal > CountTimeZones ? TimeZone::Invalid : static_cast<TimeZone>(TimeZoneShares[ordinal]);
+    }
+
+    // TimeZoneRules is dense and ordered by TimeZone ordinal, so a single bounds check guards the indexed load...
+    static const RulesType* rulesLu(const TimeZone timeZone)
+    {
+        const auto ordinal = static_cast<size_t>(timeZone);
+        if (ordinal > CountTimeZones || TimeZoneRules[ordinal].strategy == Strategy::Invalid) {
+            return nullptr; // no rules found (TimeZone::Invalid)
         }
-        // Start with the last rule and work backwards...
-        if (!rules->second->second) {
-            return Rule(); // no rules found
+        return &TimeZoneRules[ordinal];
+    }
+
+    static Interval intervalLu(const RulesType& rules, const TimeT utc)
+    {
+        if (rules.historic(utc)) {
+            return intervalLu(*rules.history, utc);
         }
-        for (auto it = rules->second->first + rules->second->second - 1;; --it) {
-            if (it->timeStart() <= utc) {
-                if constexpr (EnableRuleCache == true) {
-                    lastQuery.timeZone = timeZone;
-                    lastQuery.rule = *it;
-                }
-                return *it;
+        switch (rules.strategy) {
+        case Strategy::Fixed:
+            return { std::numeric_limits<TimeT>::min(), std::numeric_limits<TimeT>::max(), rules.rule(0) };
+        case Strategy::Periodic:
+            if (const auto rule = rules.rule(0); utc < rule.timeStart()) {
+                return { std::numeric_limits<TimeT>::min(), rule.timeStart(), rule }; // the first rule also covers any earlier time
             }
-            if (it == rules->second->first) {
-                return *rules->second->first; // no match, return first
+            return intervalLu(*rules.recurrence, utc);
+        case Strategy::Compact:
+            return compactIntervalLu(rules, utc);
+        default:
+            break;
+        }
+        if (rules.recurs(Rule::key(utc))) {
+            return intervalLu(*rules.recurrence, utc);
+        }
+        const auto i = search(rules, utc);
+        if (i + 1 == rules.count && rules.recurrence) {
+            return intervalLu(*rules.recurrence, utc); // at or beyond the last rule
+        }
+        const auto rule = rules.rule(i);
+        return {
+            i == 0 && !rules.history ? std::numeric_limits<TimeT>::min() : rule.timeStart(), // the first rule also covers any earlier time, unless history does
+            i + 1 == rules.count ? std::numeric_limits<TimeT>::max() : rules.rule(i + 1).timeStart(),
+            rule,
+        };
+    }
+
+    // Evaluates the transitions of the year of utc, and the one before or after for times outside them. The year is estimated in mean years,
+    // which can be a day or so out around New Year, so neither transition may fall within a week of it (checked by data/create-includes.py).
+    // Times around New Year then lie between the second transition of a year and the first of the next either way. Years are evaluated up to that
+    // of Rule::MaxTime, the interval starting at its second transition covering all later times...
+    //
+    static Interval intervalLu(const Recurrence& recurrence, const TimeT utc)
+    {
+        const auto& [first, second] = recurrence.transitions;
+        const auto time = std::clamp(utc, Rule::MinTime, Rule::MaxTime);
+        const auto year = static_cast<int32_t>(1970 + (time >= 0 ? time : time - (Civil::SecondsPerYear - 1)) / Civil::SecondsPerYear);
+        const auto firstTime = transitionTime(first, year, second.gmtOffset);
+        if (utc < firstTime) {
+            const auto start = transitionTime(second, year - 1, first.gmtOffset);
+            return { start, firstTime, Rule(start, second.abbreviation, second.gmtOffset, second.isDST) };
+        }
+        const auto secondTime = transitionTime(second, year, first.gmtOffset);
+        if (utc < secondTime) {
+            return { firstTime, secondTime, Rule(firstTime, first.abbreviation, first.gmtOffset, first.isDST) };
+        }
+        const auto end = utc > Rule::MaxTime ? std::numeric_limits<TimeT>::max() : transitionTime(first, year + 1, second.gmtOffset);
+        return { secondTime, end, Rule(secondTime, second.abbreviation, second.gmtOffset, second.isDST) };
+    }
+
+    // Compact tables locate rules through the year index alone. The rules starting in a year are those after the one in effect at its start, up to
+    // the one in effect at the start of the next (one starting exactly at New Year belongs to the year before), and each entry holds the time
+    // from the start of that year. The first rule's is from firstYear instead. The year index then also gives the years that the rule found
+    // and the one after it start in, normally the year searched...
+    //
+    static Interval compactIntervalLu(const RulesType& rules, const TimeT utc)
+    {
+        const auto time = std::clamp(utc, Rule::MinTime, Rule::MaxTime);
+        const auto lastYear = rules.countYears - 1;
+        const auto year = std::clamp(static_cast<int32_t>((time >= 0 ? time : time - (Civil::SecondsPerYear - 1)) / Civil::SecondsPerYear) - rules.firstYear, 0, lastYear);
+        const auto timeStart = [&rules](const int32_t y, const size_t j) {
+            return (rules.firstYear + y) * Civil::SecondsPerYear + static_cast<TimeT>(rules.data[j] >> PaletteBits);
+        };
+        const auto next = year < lastYear ? rules.years[year + 1] : rules.count - 1;
+        auto i = rules.years[year];
+        while (i < next && timeStart(year, i + 1) <= utc) {
+            ++i;
+        }
+        if (i + 1 == rules.count && rules.recurrence) {
+            return intervalLu(*rules.recurrence, utc); // at or beyond the last rule
+        }
+        auto from = year;
+        if (i == 0) {
+            from = 0;
+        } else if (i == rules.years[year]) {
+            while (rules.years[from - 1] == i) {
+                --from;
             }
+            --from;
+        }
+        auto to = year;
+        while (to < lastYear && rules.years[to + 1] <= i) {
+            ++to;
         }
+        const auto start = timeStart(from, i);
+        const Rule palette(0, rules.data[rules.count + (rules.data[i] & ((1 << PaletteBits) - 1))]);
+        return {
+            i == 0 && !rules.history ? std::numeric_limits<TimeT>::min() : start, // the first rule also covers any earlier time, unless history does
+            i + 1 == rules.count ? std::numeric_limits<TimeT>::max() : timeStart(to, i + 1),
+            Rule(start, palette.abbreviation(), palette.gmtOffset(), palette.isDST()),
+        };
     }
 
-    static inline const Map TimeZoneRulesMap = []() {
-        Map map;
-        map.reserve(CountTimeZones);
-        for (size_t i = 0; i < CountTimeZones; ++i) {
-            map.emplace(TimeZoneRules[i].first, &TimeZoneRules[i].second);
+    static constexpr TimeT transitionTime(const Transition& transition, const int32_t year, const int32_t previousOffset)
+    {
+        // Days to the start of the month counting from 1 March 0000 (as Civil::daysFromCivil), so years are positive over the range of Rule and
+        // February's length only matters for the months that follow it...
+        //
+        const auto march = transition.month > 2;
+        const auto y = static_cast<uint32_t>(year - !march);
+        const auto yearDays = y * 365 + y / 4 - y / 100 + y / 400;
+        const auto monthDays = (153 * (march ? transition.month - 3 : transition.month + 9) + 2) / 5;
+        const auto day = transition.day ? transition.day : Civil::daysInMonth(year, transition.month) - 6;
+        const auto days = yearDays + monthDays + day - 1; // from 1 March 0000, a Wednesday
+        const auto weekday = (transition.weekday + 7 - (days + 3) % 7) % 7;
+        return (static_cast<TimeT>(days + weekday) - 719468) * Civil::SecondsPerDay + transition.localSeconds - previousOffset;
+    }
+
+    // Finds the last rule starting at or before utc, O(1) regardless of History or how far back the query goes. The year index gives the rule
+    // in effect at the start of the year, and at most a few transitions follow within it. Years before the first or after the last in the
+    // index use its ends, the first rule covering any earlier time...
+    //
+    static uint16_t search(const RulesType& rules, const TimeT utc)
+    {
+        const auto key = Rule::key(utc);
+        const auto time = std::clamp(utc, Rule::MinTime, Rule::MaxTime);
+        const auto year = static_cast<int32_t>((time >= 0 ? time : time - (Civil::SecondsPerYear - 1)) / Civil::SecondsPerYear);
+        const auto last = static_cast<uint16_t>(rules.count - 1);
+        auto i = rules.years[std::clamp(year - rules.firstYear, 0, rules.countYears - 1)];
+        while (i < last && rules.keys[i + 1] <= key) {
+            ++i;
         }
-        return map;
-    }();
+        return settle(rules, i, key, utc);
+    }
+
+    // Completes a search narrowed to count <= SearchWindow keys from first, returning the index of the last key at or before key...
+    static uint16_t finish(const RulesType& rules, const int32_t* first, uint16_t count, const int32_t key)
+    {
+        if (rules.count >= SearchWindow) {
+            // Keys before first are all at or before key and those from first + count on are after it, so the window may slide back to end
+            // within the span. The count of keys at or before key then locates the rule...
+            //
+            first = std::min(first, rules.keys + rules.count - SearchWindow);
+            const auto n = countNotAfter(first, key);
+            return static_cast<uint16_t>(first - rules.keys + (n ? n - 1 : 0));
+        }
+        for (; count > 1; count -= count / 2) {
+            first = first[count / 2] <= key ? first + count / 2 : first;
+        }
+        return static_cast<uint16_t>(first - rules.keys);
+    }
+
+    // Binary search gives way to counting once a span is narrowed to this many keys, 2 cache lines of them...
+    static constexpr uint16_t SearchWindow = 32;
+
+    // Counts the keys in [keys, keys + SearchWindow) at or before key. Vector compares yield -1 for each key after it, summed across lanes...
+    static uint16_t countNotAfter(const int32_t* keys, const int32_t key)
+    {
+#if defined(__AVX2__) || defined(__SSE2__) || defined(_M_X64)
+#if defined(__AVX2__)
+        const auto k = _mm256_set1_epi32(key);
+        auto after = _mm256_setzero_si256();
+        for (size_t i = 0; i < SearchWindow; i += 8) {
+            after = _mm256_add_epi32(after, _mm256_cmpgt_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(keys + i)), k));
+        }
+        auto sum = _mm_add_epi32(_mm256_castsi256_si128(after), _mm256_extracti128_si256(after, 1));
+#else
+        const auto k = _mm_set1_epi32(key);
+        auto sum = _mm_setzero_si128();
+        for (size_t i = 0; i < SearchWindow; i += 4) {
+            sum = _mm_add_epi32(sum, _mm_cmpgt_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(keys + i)), k));
+        }
+#endif
+        sum = _mm_add_epi32(sum, _mm_shuffle_epi32(sum, 0x4e));
+        sum = _mm_add_epi32(sum, _mm_shuffle_epi32(sum, 0xb1));
+        return static_cast<uint16_t>(SearchWindow + _mm_cvtsi128_si32(sum));
+#else
+        uint16_t count {};
+        for (size_t i = 0; i < SearchWindow; ++i) {
+            count += keys[i] <= key;
+        }
+        return count;
+#endif
+    }
+
+    // Keys are timeStart / 16, so rules sharing the key of utc may start after it. Only these need decoding, and they step back...
+    static uint16_t settle(const RulesType& rules, uint16_t i, const int32_t key, const TimeT utc)
+    {
+        while (rules.keys[i] == key && rules.rule(i).timeStart() > utc && i > 0) {
+            --i;
+        }
+        return i;
+    }
+
+    // Visits each interval within the margin of local, collecting the UTC times they map it to. None means local is in a gap...
+    static std::pair<TimeT, bool> resolveLocal(const RulesType& rules, const TimeT local, const Policy policy)
+    {
+        auto earliest = std::numeric_limits<TimeT>::max();
+        auto latest = std::numeric_limits<TimeT>::min();
+        TimeT transition {};
+        bool previousBefore {};
+        for (auto interval = intervalLu(rules, local - LocalMargin);;) {
+            const auto utc = local - static_cast<TimeT>(interval.rule.gmtOffset());
+            if (interval.contains(utc)) {
+                earliest = std::min(earliest, utc);
+                latest = std::max(latest, utc);
+            } else if (utc < interval.start && previousBefore) {
+                transition = interval.start; // local was skipped when this interval started
+            }
+            previousBefore = utc >= interval.end;
+            if (interval.end > local + LocalMargin || interval.end == std::numeric_limits<TimeT>::max()) {
+                break;
+            }
+            const auto next = intervalLu(rules, interval.end);
+            if (next.end <= interval.end) {
+                break; // no further intervals
+            }
+            interval = next;
+        }
+        if (policy == Policy::Reject && earliest != latest) {
+            return std::make_pair(static_cast<TimeT>(-1), false); // gap or overlap
+        }
+        if (earliest > latest) {
+            return std::make_pair(transition, true); // gap
+        }
+        return std::make_pair(policy == Policy::Latest ? latest : earliest, true);
+    }
+
+    static void prefetch(const void* p)
+    {
+#ifdef _MSC_VER
+        _mm_prefetch(static_cast<const char*>(p), _MM_HINT_T0);
+#else
+        __builtin_prefetch(p);
+#endif
+    }
+
+    // Adds offset to utc[i] onwards for as long as the times stay within [start, end), returns the index of the first time outside...
+    static size_t applyOffset(const TimeT* utc, TimeT* local, size_t i, const size_t count, const Interval& interval)
+    {
+        const auto offset = static_cast<TimeT>(interval.rule.gmtOffset());
+#if defined(__AVX2__)
+        const auto start = _mm256_set1_epi64x(interval.start);
+        const auto last = _mm256_set1_epi64x(interval.end - 1);
+        const auto delta = _mm256_set1_epi64x(offset);
+        for (; i + 4 <= count; i += 4) {
+            const auto times = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(utc + i));
+            const auto outside = _mm256_or_si256(_mm256_cmpgt_epi64(start, times), _mm256_cmpgt_epi64(times, last));
+            if (!_mm256_testz_si256(outside, outside)) {
+                break; // finish the run with scalar code
+            }
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(local + i), _mm256_add_epi64(times, delta));
+        }
+#endif
+        for (; i < count && interval.contains(utc[i]); ++i) {
+            local[i] = utc[i] + offset;
+        }
+        return i;
+    }
 
 public:
+    // Rules and years shared between time zones (see TimeZoneShares) are counted once. Histories are counted by data/create-includes.py, as
+    // testing their pointers is not a constant expression in sanitized builds...
+    //
     static constexpr size_t CountTimeZoneRules = []{
-        size_t count { };
-        for (size_t i = 0; i < CountTimeZones; ++i) {
-            count += TimeZoneRules[i].second.second;
+        size_t count { CountHistoryRules };
+        for (size_t i = 0; i <= CountTimeZones; ++i) {
+            count += TimeZoneShares[i] == i ? TimeZoneRules[i].count : 0;
+        }
+        return count;
+    }();
+
+    static constexpr size_t CountTimeZoneYears = []{
+        size_t count { CountHistoryYears };
+        for (size_t i = 0; i <= CountTimeZones; ++i) {
+            count += TimeZoneShares[i] == i ? TimeZoneRules[i].countYears : 0;
         }
         return count;
     }();
 
     static inline auto toLocal(const TimeZone timeZone, const TimeT utc)
     {
-        const auto rule = ruleLu(timeZone, utc);
+        const auto rule = intervalLu(timeZone, utc).rule;
         if (!rule.isValid()) {
             return std::make_pair(static_cast<TimeT>(-1), false);
         }
         return std::make_pair(utc + static_cast<TimeT>(rule.gmtOffset()), true);
     }
+
+    // As toLocal, broken down into local calendar fields along with the rule that applies. Fails for local times outside
+    // [Civil::MinTime, Civil::MaxTime], whose year LocalDateTime cannot hold...
+    //
+    static inline auto toLocalFields(const TimeZone timeZone, const TimeT utc)
+    {
+        const auto rule = intervalLu(timeZone, utc).rule;
+        if (!rule.isValid() || utc < Civil::MinTime - rule.gmtOffset() || utc > Civil::MaxTime - rule.gmtOffset()) {
+            return std::make_pair(LocalDateTime(), false);
+        }
+        return std::make_pair(LocalDateTime(utc + static_cast<TimeT>(rule.gmtOffset()), rule), true);
+    }
+
+    static inline auto fromLocal(const TimeZone timeZone, const TimeT local, const Policy policy = Policy::Earliest)
+    {
+        const auto interval = intervalLu(timeZone, local);
+        if (!interval.rule.isValid()) {
+            return std::make_pair(static_cast<TimeT>(-1), false);
+        }
+        const auto utc = local - static_cast<TimeT>(interval.rule.gmtOffset());
+        if (utc - LocalMargin >= interval.start && utc + LocalMargin < interval.end) {
+            return std::make_pair(utc, true);
+        }
+        return resolveLocal(*rulesLu(timeZone), local, policy);
+    }
+
+    // Batch conversion of count UTC times for one time zone. Each transition is looked up once and its offset applied across the run of times
+    // it covers, 4 at a time on AVX2 builds. Runs are longest when utc is sorted but any order is supported. local may alias utc. Returns false
+    // (with local filled with -1) for an unknown time zone...
+    //
+    static inline bool toLocal(const TimeZone timeZone, const TimeT* utc, TimeT* local, const size_t count)
+    {
+        const auto* const rules = rulesLu(timeZone);
+        if (!rules) {
+            std::fill(local, local + count, static_cast<TimeT>(-1));
+            return false;
+        }
+        for (size_t i = 0; i < count;) {
+            const auto interval = intervalLu(*rules, utc[i]);
+            local[i] = utc[i] + static_cast<TimeT>(interval.rule.gmtOffset()); // always progress, even if utc[i] is the very last TimeT
+            i = applyOffset(utc, local, i + 1, count, interval);
+        }
+        return true;
+    }
+
+    // Batch conversion of (time zone, UTC time) pairs given as parallel arrays. The binary searches for a group of pairs advance in lockstep,
+    // so the dependent loads of one pair overlap with those of the rest of the group rather than serializing, while the first probes of the
+    // next group are prefetched. local may alias utc. Returns false if any time zone is unknown (the corresponding local times are set to -1)...
+    //
+    static inline bool toLocal(const TimeZone* timeZones, const TimeT* utc, TimeT* local, const size_t count)
+    {
+        static constexpr size_t Group = 8;
+        static constexpr int32_t NoKeys[1] {};
+        static constexpr uint32_t NoData[1] {};
+        static constexpr RulesType NoRules = Fixed(NoKeys, NoData); // a single invalid rule
+
+        bool result = true;
+        for (size_t i = 0; i < count; i += Group) {
+            const auto n = std::min(Group, count - i);
+            const RulesType* rules[Group];
+            const int32_t* first[Group];
+            uint16_t remaining[Group];
+            int32_t keys[Group];
+            bool searched[Group];
+            uint16_t widest = 1;
+
+            for (size_t j = 0; j < n; ++j) {
+                const auto* const found = rulesLu(timeZones[i + j]);
+                rules[j] = found ? found : &NoRules;
+                keys[j] = Rule::key(utc[i + j]);
+                searched[j] = rules[j]->searches(keys[j]); // others need no search, stepping over NoKeys is a no-op
+                first[j] = searched[j] ? rules[j]->keys : NoKeys;
+                remaining[j] = searched[j] ? rules[j]->count : 1;
+                widest = std::max(widest, remaining[j]);
+            }
+            for (size_t j = i + Group; j < std::min(i + 2 * Group, count); ++j) {
+                if (const auto* const found = rulesLu(timeZones[j]); found && found->strategy == Strategy::Table) {
+                    prefetch(found->keys + found->count / 2);
+                }
+            }
+            // Every search takes the same halving steps as the widest one, narrower searches settle early and then step by zero. This keeps the
+            // loop free of per-pair branches, which would mispredict as spans vary from one rule to over a thousand. Each search is then
+            // finished on its own, as UTC::search does...
+            //
+            for (; widest > SearchWindow; widest -= widest / 2) {
+                for (size_t j = 0; j < n; ++j) {
+                    const auto half = remaining[j] / 2;
+                    first[j] = first[j][half] <= keys[j] ? first[j] + half : first[j];
+                    remaining[j] -= half;
+                }
+            }
+            for (size_t j = 0; j < n; ++j) {
+                Rule rule;
+                if (!searched[j]) {
+                    rule = intervalLu(*rules[j], utc[i + j]).rule;
+                } else if (const auto k = settle(*rules[j], finish(*rules[j], first[j], remaining[j], keys[j]), keys[j], utc[i + j]); k + 1 < rules[j]->count || !rules[j]->recurrence) {
+                    rule = rules[j]->rule(k);
+                } else {
+                    rule = intervalLu(*rules[j]->recurrence, utc[i + j]).rule; // at or beyond the last rule
+                }
+                if (!rule.isValid()) {
+                    local[i + j] = -1;
+                    result = false;
+                    continue;
+                }
+                local[i + j] = utc[i + j] + static_cast<TimeT>(rule.gmtOffset());
+            }
+        }
+        return result;
+    }
 };
 
 
@@ -169,6 +878,12 @@ public:
 class Time
 {
 public:
+    static constexpr size_t ISOStringLength = 19;
+
+    // The range of times with a year in [0, 9999], which toISOString formats...
+    static constexpr TimeT MinISOTime = -62167219200; // 0000-01-01T00:00:00
+    static constexpr TimeT MaxISOTime = 253402300799; // 9999-12-31T23:59:59
+
     static auto now()
     {
         thread_local static std::time_t t;
@@ -178,107 +893,143 @@ public:
     // Simplified extended ISO8601-1:2019 format without decimal fractions (milliseconds), and without zone (as we want to render local time)...
     static auto toISOString(const TimeT time)
     {
-        std::tm tm;
-        const auto _time = static_cast<std::time_t>(time);
-
-#ifdef _MSC_VER
-        if (gmtime_s(&tm, &_time)) {
+        std::array<char, 20> buffer {};
+        if (!toISOString(time, buffer)) {
             return std::string();
         }
-#else
-        if (!gmtime_r(&_time, &tm)) {
-            return std::string();
-        }
-#endif
-        return format("%4.4d-%2.2d-%2.2dT%2.2d:%2.2d:%2.2d", tm.tm_year + 1900, tm.tm_mon + 1, tm.tm_mday, tm.tm_hour, tm.tm_min, tm.tm_sec);
+        return std::string(buffer.data(), ISOStringLength);
     }
 
-    // e.g. 2020-11-23T19:20:21...
-    static auto fromISOString(const std::string& time)
+    // Writes exactly ISOStringLength characters (without a terminator) to buffer, returns false if time is outside [MinISOTime, MaxISOTime].
+    // No libc, locale or heap, so suitable for hot logging paths...
+    //
+    static constexpr bool toISOString(const TimeT time, char* buffer)
     {
-        const auto checkedScan = [](const int count, const char* buf, const char* fmt, ...) {
-            va_list ap;
-            va_start(ap, fmt);
-            const auto c = vsscanf(buf, fmt, ap);
-            va_end(ap);
-            return c == count;
+        if (time < MinISOTime || time > MaxISOTime) {
+            return false;
+        }
+        const auto date = Civil::civilFromDays(Civil::days(time));
+        const auto seconds = Civil::secondsOfDay(time);
+        const auto put = [](char* p, const uint32_t value) {
+            p[0] = Digits[value * 2];
+            p[1] = Digits[value * 2 + 1];
         };
+        put(buffer, static_cast<uint32_t>(date.year) / 100);
+        put(buffer + 2, static_cast<uint32_t>(date.year) % 100);
+        buffer[4] = '-';
+        put(buffer + 5, date.month);
+        buffer[7] = '-';
+        put(buffer + 8, date.day);
+        buffer[10] = 'T';
+        put(buffer + 11, seconds / 3600);
+        buffer[13] = ':';
+        put(buffer + 14, seconds / 60 % 60);
+        buffer[16] = ':';
+        put(buffer + 17, seconds % 60);
+        return true;
+    }
 
-        if (time.length() != 19) {
-            return std::make_pair(static_cast<TimeT>(-1), false);
-        }
-        static const size_t Params = 6;
-        std::tm tm {};
-        if (!checkedScan(Params, time.c_str(), "%4d-%2d-%2dT%2d:%2d:%2d", &tm.tm_year, &tm.tm_mon, &tm.tm_mday, &tm.tm_hour, &tm.tm_min, &tm.tm_sec) || !tm.tm_mday) {
-            return std::make_pair(static_cast<TimeT>(-1), false);
+    // As above, null terminated...
+    static constexpr bool toISOString(const TimeT time, std::array<char, 20>& buffer)
+    {
+        buffer[ISOStringLength] = '\0';
+        return toISOString(time, buffer.data());
+    }
+
+    // e.g. 2020-11-23T19:20:21, interpreted as UTC. Fixed position parse with range validation, no locale, libc or heap...
+    static constexpr std::pair<TimeT, bool> fromISOString(const std::string_view time)
+    {
+        const auto fail = std::make_pair(static_cast<TimeT>(-1), false);
+        if (time.length() != ISOStringLength || time[4] != '-' || time[7] != '-' || time[10] != 'T' || time[13] != ':' || time[16] != ':') {
+            return fail;
         }
-        tm.tm_year -= 1900;
-        tm.tm_mon--;
-        tm.tm_isdst = -1;
-        const auto t = std::mktime(&tm);
-        if (t == -1) {
-            return std::make_pair(static_cast<TimeT>(-1), false);
+        bool valid = true;
+        const auto digits = [&time, &valid](const size_t pos, const size_t count) {
+            uint32_t value {};
+            for (size_t i = pos; i < pos + count; ++i) {
+                const auto digit = static_cast<uint32_t>(time[i] - '0');
+                valid &= digit < 10;
+                value = value * 10 + digit;
+            }
+            return value;
+        };
+        const auto year = static_cast<int32_t>(digits(0, 4));
+        const auto month = digits(5, 2);
+        const auto day = digits(8, 2);
+        const auto hour = digits(11, 2);
+        const auto minute = digits(14, 2);
+        const auto second = digits(17, 2);
+        if (!valid || month < 1 || month > 12 || day < 1 || day > Civil::daysInMonth(year, month) || hour > 23 || minute > 59 || second > 59) {
+            return fail;
         }
-        return std::make_pair(static_cast<TimeT>(t), true);
+        return std::make_pair(Civil::daysFromCivil(year, month, day) * Civil::SecondsPerDay + hour * 3600 + minute * 60 + second, true);
     }
 
 private:
-    template <typename... A> static std::string format(const std::string& format, A... args)
-    {
-        const auto size = snprintf(nullptr, 0, format.c_str(), args...) + 1;
-        if (size <= 0) {
-            return "";
+    // "00", "01" ... "99"...
+    static constexpr auto Digits = [] {
+        std::array<char, 200> digits {};
+        for (size_t i = 0; i < 100; ++i) {
+            digits[i * 2] = static_cast<char>('0' + i / 10);
+            digits[i * 2 + 1] = static_cast<char>('0' + i % 10);
         }
-        const std::unique_ptr<char[]> buf(new char[size]);
-        snprintf(buf.get(), size, format.c_str(), args...);
-        return std::string(buf.get(), buf.get() + size - 1);
-    }
+        return digits;
+    }();
 };
 
 
 //-----------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
-// Helper lookup class.
+// Helper lookup class. Names are pooled null terminated strings indexed by ordinal through offsets, so the tables hold no pointers needing relocation,
+// and are found by a minimal perfect hash generated with them (see create-includes.py), so a lookup costs at most two hashes and one string compare,
+// needs no heap and can be evaluated at compile time...
 //
 template <typename Enum> class Enums
 {
+    static constexpr size_t Count = static_cast<size_t>(Enum::_MAX);
+
 public:
-    constexpr Enums() { }
+    constexpr Enums(const char* names, const uint16_t (&offsets)[Count + 1], const int16_t (&seeds)[Count], const uint16_t (&slots)[Count])
+        : m_names(names)
+        , m_offsets(offsets)
+        , m_seeds(seeds)
+        , m_slots(slots)
+    {
+    }
 
     Enums(const Enums&) = delete;
     Enums& operator=(const Enums&) = delete;
 
-    auto key(const std::string& value)
+    constexpr Enum key(const std::string_view value) const
     {
-        const auto it = m_values.find(value);
-        if (it == m_values.end()) {
-            return Enum::Invalid;
-        }
-        return Enum(it->second);
+        // A negative seed is the slot of the only name in its bucket, otherwise the seed rehashes the bucket's names to distinct slots...
+        const auto seed = m_seeds[hash(0, value) % Count];
+        const auto ordinal = m_slots[seed < 0 ? static_cast<uint32_t>(-1 - seed) : hash(static_cast<uint32_t>(seed), value) % Count];
+        return name(ordinal) == value ? Enum(ordinal) : Enum::Invalid;
     }
 
-    auto value(const Enum key)
+    constexpr std::string_view value(const Enum key) const
     {
-        for (const auto& [k, v] : m_values) {
-            if (v == uint16_t(key)) {
-                return k;
-            }
-        }
-        return std::string();
+        const auto ordinal = static_cast<size_t>(key);
+        return ordinal < Count ? name(ordinal) : std::string_view();
     }
 
-protected:
-    using Map = std::unordered_map<std::string, uint16_t>;
+private:
+    constexpr std::string_view name(const size_t ordinal) const { return { m_names + m_offsets[ordinal], m_offsets[ordinal + 1] - m_offsets[ordinal] - 1u }; }
 
-    // Don't use initializer_lists for static initialization as most compilers will generate a temporary variable with a large stack requirement...
-    template <typename T, size_t N> constexpr auto makeMap(T (&names)[N])
+    // 32 bit FNV-1a from a seeded basis, as nameHash in create-includes.py...
+    static constexpr uint32_t hash(const uint32_t seed, const std::string_view value)
     {
-        m_values.reserve(N);
-        for (uint16_t i = 0; i < N; ++i) {
-            m_values.emplace(std::make_pair(names[i], i));
+        auto h = 2166136261u ^ seed;
+        for (const auto c : value) {
+            h = (h ^ static_cast<uint8_t>(c)) * 16777619u;
         }
+        return h;
     }
 
-    Map m_values;
+    const char* m_names;
+    const uint16_t* m_offsets;
+    const int16_t* m_seeds;
+    const uint16_t* m_slots;
 };
 
 
@@ -288,15 +1039,19 @@ class Abbreviations : public Enums<Abbreviation>
 #include "etz-data/abbreviation-names.inl"
 
 public:
-    constexpr Abbreviations() { makeMap(AbbreviationNames); }
-
-    static Abbreviations* getInstance()
+    constexpr Abbreviations()
+        : Enums(AbbreviationNames, AbbreviationNameOffsets, AbbreviationHashSeeds, AbbreviationHashSlots)
     {
-        static Abbreviations instance;
-        return &instance;
     }
+
+    static constexpr const Abbreviations* getInstance() { return &Instance; }
+
+private:
+    static const Abbreviations Instance;
 };
 
+inline constexpr Abbreviations Abbreviations::Instance {};
+
 
 //-----------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
 class TimeZones : public Enums<TimeZone>
@@ -304,23 +1059,74 @@ class TimeZones : public Enums<TimeZone>
 #include "etz-data/timezone-names.inl"
 
 public:
-    constexpr TimeZones() { makeMap(TimeZoneNames); }
+    constexpr TimeZones()
+        : Enums(TimeZoneNames, TimeZoneNameOffsets, TimeZoneHashSeeds, TimeZoneHashSlots)
+    {
+    }
 
-    auto ianaToEnumName(const std::string& key)
+    auto ianaToEnumName(const std::string_view key) const
     {
-        auto v = key;
+        std::string v(key);
         std::replace(v.begin(), v.end(), '/', '_');
         std::replace(v.begin(), v.end(), '-', '_');
         return v;
     }
 
-    static TimeZones* getInstance()
+    static constexpr const TimeZones* getInstance() { return &Instance; }
+
+private:
+    static const TimeZones Instance;
+};
+
+inline constexpr TimeZones TimeZones::Instance {};
+
+
+//-----------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+// ISO 3166-1 alpha-2 country codes, with an index of the time zones of each country, and of the country of each time zone, generated with them...
+//
+class Countries : public Enums<Country>
+{
+#include "etz-data/country-names.inl"
+
+    static_assert(sizeof(CountryTimeZoneOffsets) / sizeof(CountryTimeZoneOffsets[0]) == static_cast<size_t>(Country::_MAX) + 1, "CountryTimeZoneOffsets must be indexed by Country ordinal");
+    static_assert(sizeof(TimeZoneCountries) / sizeof(TimeZoneCountries[0]) == static_cast<size_t>(TimeZone::_MAX), "TimeZoneCountries must be indexed by TimeZone ordinal");
+
+public:
+    struct TimeZoneRange {
+        const TimeZone* first;
+        const TimeZone* last;
+
+        constexpr const TimeZone* begin() const { return first; }
+        constexpr const TimeZone* end() const { return last; }
+        constexpr size_t size() const { return static_cast<size_t>(last - first); }
+    };
+
+    constexpr Countries()
+        : Enums(CountryNames, CountryNameOffsets, CountryHashSeeds, CountryHashSlots)
+    {
+    }
+
+    // The time zones of a country, empty for Country::Invalid or a country without one...
+    constexpr TimeZoneRange timeZones(const Country country) const
+    {
+        const auto ordinal = static_cast<size_t>(country) < static_cast<size_t>(Country::_MAX) ? static_cast<size_t>(country) : 0;
+        return { CountryTimeZones + CountryTimeZoneOffsets[ordinal], CountryTimeZones + CountryTimeZoneOffsets[ordinal + 1] };
+    }
+
+    constexpr Country country(const TimeZone timeZone) const
     {
-        static TimeZones instance;
-        return &instance;
+        const auto ordinal = static_cast<size_t>(timeZone);
+        return ordinal < static_cast<size_t>(TimeZone::_MAX) ? TimeZoneCountries[ordinal] : Country::Invalid;
     }
+
+    static constexpr const Countries* getInstance() { return &Instance; }
+
+private:
+    static const Countries Instance;
 };
 
+inline constexpr Countries Countries::Instance {};
+
 
 //-----------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
 inline TimeZone& operator++(TimeZone& tz)
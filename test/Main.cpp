@@ -5,8 +5,11 @@
 
 #include <algorithm>
 #include <chrono>
+#include <cstdarg>
 #include <functional>
 #include <list>
+#include <memory>
+#include <random>
 #include <sstream>
 
 
@@ -16,6 +19,20 @@ constexpr auto ColumnWidth = 30;
 
 using namespace ETZ;
 
+static_assert(Time::fromISOString("2020-11-23T19:20:21").first == 1606159221);
+static_assert(Time::fromISOString("0000-01-01T00:00:00").first == Time::MinISOTime && Time::fromISOString("9999-12-31T23:59:59").first == Time::MaxISOTime);
+static_assert(Civil::civilFromDays(Civil::days(Civil::MinTime)).year == std::numeric_limits<int32_t>::min());
+static_assert(Civil::civilFromDays(Civil::days(Civil::MaxTime)).year == std::numeric_limits<int32_t>::max());
+
+// Name lookups in both directions are constant expressions, so the lookup tables are constant initialized rather than built at start-up...
+static_assert(TimeZones::getInstance()->key("Europe/London") == TimeZone::Europe_London);
+static_assert(TimeZones::getInstance()->key("Europe/Londo") == TimeZone::Invalid);
+static_assert(Abbreviations::getInstance()->key("GMT") == Abbreviation::GMT);
+static_assert(TimeZones::getInstance()->value(TimeZone::Europe_London) == "Europe/London");
+static_assert(Countries::getInstance()->key("GB") == Country::ISO_GB);
+static_assert(Countries::getInstance()->country(TimeZone::Europe_London) == Country::ISO_GB);
+static_assert(Countries::getInstance()->timeZones(Country::ISO_GB).size() == 1 && *Countries::getInstance()->timeZones(Country::ISO_GB).begin() == TimeZone::Europe_London);
+
 
 //-----------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
 static void locals(const std::string& utc)
@@ -72,6 +89,27 @@ static void timeZones()
 }
 
 
+//-----------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+static void countries()
+{
+    Log::test(std::string(LineWidth, '='));
+    Log::test(std::left, std::setw(ColumnWidth / 2), "Country (ISO)", " | ", "Time zones (IANA names)");
+    Log::test(std::string(LineWidth, '='));
+
+    auto* const enums = Countries::getInstance();
+    for (uint16_t ordinal = 1; ordinal < static_cast<uint16_t>(Country::_MAX); ++ordinal) {
+        const auto country = static_cast<Country>(ordinal);
+        std::stringstream ss;
+        ss << std::left << std::setw(ColumnWidth / 2) << enums->value(country) << " |";
+        for (const auto tz : enums->timeZones(country)) {
+            ss << " " << TimeZones::getInstance()->value(tz);
+        }
+        Log::test(ss.str());
+    }
+    Log::test(std::string(LineWidth, '='), Log::LF);
+}
+
+
 //-----------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
 #ifdef _MSC_VER
 
@@ -89,10 +127,189 @@ template <class T> static void doNotOptimizeAway(T&& datum) { asm volatile("" :
 
 #endif
 
+// The previous Time::fromISOString (vsscanf + mktime), kept to benchmark against...
+static std::pair<TimeT, bool> scanfFromISOString(const std::string& time)
+{
+    const auto checkedScan = [](const int count, const char* buf, const char* fmt, ...) {
+        va_list ap;
+        va_start(ap, fmt);
+        const auto c = vsscanf(buf, fmt, ap);
+        va_end(ap);
+        return c == count;
+    };
+
+    if (time.length() != 19) {
+        return std::make_pair(static_cast<TimeT>(-1), false);
+    }
+    static const size_t Params = 6;
+    std::tm tm {};
+    if (!checkedScan(Params, time.c_str(), "%4d-%2d-%2dT%2d:%2d:%2d", &tm.tm_year, &tm.tm_mon, &tm.tm_mday, &tm.tm_hour, &tm.tm_min, &tm.tm_sec) || !tm.tm_mday) {
+        return std::make_pair(static_cast<TimeT>(-1), false);
+    }
+    tm.tm_year -= 1900;
+    tm.tm_mon--;
+    tm.tm_isdst = -1;
+    const auto t = std::mktime(&tm);
+    if (t == -1) {
+        return std::make_pair(static_cast<TimeT>(-1), false);
+    }
+    return std::make_pair(static_cast<TimeT>(t), true);
+}
+
+// The previous Time::toISOString (gmtime_r + snprintf + heap), kept to benchmark against...
+static std::string snprintfToISOString(const TimeT time)
+{
+    std::tm tm;
+    const auto _time = static_cast<std::time_t>(time);
+
+#ifdef _MSC_VER
+    if (gmtime_s(&tm, &_time)) {
+        return std::string();
+    }
+#else
+    if (!gmtime_r(&_time, &tm)) {
+        return std::string();
+    }
+#endif
+    static const char* const format = "%4.4d-%2.2d-%2.2dT%2.2d:%2.2d:%2.2d";
+    const auto size = snprintf(nullptr, 0, format, tm.tm_year + 1900, tm.tm_mon + 1, tm.tm_mday, tm.tm_hour, tm.tm_min, tm.tm_sec) + 1;
+    if (size <= 0) {
+        return "";
+    }
+    const std::unique_ptr<char[]> buf(new char[size]);
+    snprintf(buf.get(), size, format, tm.tm_year + 1900, tm.tm_mon + 1, tm.tm_mday, tm.tm_hour, tm.tm_min, tm.tm_sec);
+    return std::string(buf.get(), buf.get() + size - 1);
+}
+
+// Checks conversions against known transitions, each other and libc, returns false on any failure...
+static bool check()
+{
+    Log::test(std::string(LineWidth, '='));
+    Log::test(Log::LF, "Checking conversions (EnableCompactRules: ", EnableCompactRules ? "true" : "false", ")");
+    Log::test(std::string(LineWidth, '='));
+
+    size_t failures {};
+    const auto expect = [&failures](const bool condition, const auto&... what) {
+        if (!condition) {
+            Log::test("FAILED: ", what...);
+            ++failures;
+        }
+    };
+
+    Log::test(Log::LF, "Local to UTC, gaps and overlaps...");
+
+    {
+        struct Case {
+            TimeZone timeZone;
+            const char* local;
+            TimeT earliest;
+            TimeT latest;
+        };
+        static constexpr Case Cases[] = {
+            { TimeZone::Europe_London, "2021-03-28T01:30:00", 1616893200, 1616893200 }, // gap, both give the transition
+            { TimeZone::Europe_London, "2021-10-31T01:30:00", 1635640200, 1635643800 }, // overlap
+            { TimeZone::America_New_York, "2021-03-14T02:30:00", 1615705200, 1615705200 },
+            { TimeZone::America_New_York, "2021-11-07T01:30:00", 1636263000, 1636266600 },
+        };
+        for (const auto& c : Cases) {
+            const auto local = Time::fromISOString(c.local).first;
+            const auto name = TimeZones::getInstance()->value(c.timeZone);
+            expect(UTC::fromLocal(c.timeZone, local, UTC::Policy::Earliest) == std::make_pair(c.earliest, true), name, " ", c.local, " Earliest");
+            expect(UTC::fromLocal(c.timeZone, local, UTC::Policy::Latest) == std::make_pair(c.latest, true), name, " ", c.local, " Latest");
+            expect(!UTC::fromLocal(c.timeZone, local, UTC::Policy::Reject).second, name, " ", c.local, " Reject");
+        }
+        const auto local = Time::fromISOString("2021-07-01T12:00:00").first;
+        expect(UTC::fromLocal(TimeZone::Europe_London, local, UTC::Policy::Reject) == std::make_pair(local - 3600, true), "Europe/London 2021-07-01T12:00:00 Reject");
+    }
+
+    Log::test(Log::LF, "UTC to local and back, each time zone from 1900 to beyond the last rule...");
+
+    {
+        std::vector<TimeT> times;
+        for (TimeT t = -2208988800; t < 4102444800; t += 7 * 86400 + 3607) {
+            times.push_back(t); // 1900 to 2100
+        }
+        for (TimeT t = 4102444800; t <= Time::MaxISOTime; t += 97 * 86400 + 3607) {
+            times.push_back(t); // to 9999, past Rule::MaxTime
+        }
+        std::vector<TimeT> local(times.size());
+        auto tz = TimeZone::Invalid;
+        for (++tz; tz != TimeZone::Invalid; ++tz) {
+            const auto name = TimeZones::getInstance()->value(tz);
+            size_t mismatches {};
+            for (size_t i = 0; i < times.size(); ++i) {
+                const auto [l, valid] = UTC::toLocal(tz, times[i]);
+                const auto earliest = UTC::fromLocal(tz, l, UTC::Policy::Earliest).first;
+                const auto latest = UTC::fromLocal(tz, l, UTC::Policy::Latest).first;
+                mismatches += !valid || (earliest != times[i] && latest != times[i]) || UTC::toLocal(tz, earliest).first != l || UTC::toLocal(tz, latest).first != l;
+            }
+            expect(!mismatches, name, " round trips: ", mismatches, " mismatches");
+
+            UTC::toLocal(tz, times.data(), local.data(), times.size());
+            size_t batch {};
+            for (size_t i = 0; i < times.size(); ++i) {
+                batch += local[i] != UTC::toLocal(tz, times[i]).first;
+            }
+            expect(!batch, name, " batch toLocal: ", batch, " mismatches");
+        }
+
+        std::vector<TimeZone> timeZones(times.size());
+        std::mt19937_64 rng;
+        std::uniform_int_distribution<uint16_t> zoneDist(1, static_cast<uint16_t>(UTC::CountTimeZones));
+        std::generate(timeZones.begin(), timeZones.end(), [&]() { return TimeZone(zoneDist(rng)); });
+        UTC::toLocal(timeZones.data(), times.data(), local.data(), times.size());
+        size_t batch {};
+        for (size_t i = 0; i < times.size(); ++i) {
+            batch += local[i] != UTC::toLocal(timeZones[i], times[i]).first;
+        }
+        expect(!batch, "batch toLocal of (time zone, time) pairs: ", batch, " mismatches");
+    }
+
+    Log::test(Log::LF, "Calendar fields and ISO8601 strings against gmtime_r...");
+
+    {
+        std::mt19937_64 rng;
+        std::uniform_int_distribution<TimeT> dist(Time::MinISOTime, Time::MaxISOTime);
+        std::vector<TimeT> times(100000);
+        std::generate(times.begin(), times.end(), [&]() { return dist(rng); });
+        times.push_back(Time::MinISOTime);
+        times.push_back(Time::MaxISOTime);
+
+        std::vector<int32_t> years(times.size());
+        std::vector<uint8_t> months(times.size()), days(times.size()), hours(times.size()), minutes(times.size()), seconds(times.size()), weekdays(times.size());
+        Civil::decompose(times.data(), times.size(), { years.data(), months.data(), days.data(), hours.data(), minutes.data(), seconds.data(), weekdays.data() });
+
+        size_t mismatches {};
+        for (size_t i = 0; i < times.size(); ++i) {
+            std::tm tm;
+            const auto time = static_cast<std::time_t>(times[i]);
+#ifdef _MSC_VER
+            gmtime_s(&tm, &time);
+#else
+            gmtime_r(&time, &tm);
+#endif
+            mismatches += years[i] != tm.tm_year + 1900 || months[i] != tm.tm_mon + 1 || days[i] != tm.tm_mday || hours[i] != tm.tm_hour || minutes[i] != tm.tm_min
+                || seconds[i] != tm.tm_sec || weekdays[i] != tm.tm_wday;
+            const auto iso = Time::toISOString(times[i]);
+            mismatches += iso != snprintfToISOString(times[i]) || Time::fromISOString(iso) != std::make_pair(times[i], true);
+        }
+        expect(!mismatches, "calendar fields and ISO8601 strings: ", mismatches, " mismatches");
+
+        std::array<char, 20> buffer {};
+        expect(!Time::toISOString(Time::MinISOTime - 1, buffer) && !Time::toISOString(Time::MaxISOTime + 1, buffer), "toISOString outside years [0, 9999]");
+        expect(!Time::toISOString((4294967296 + 50) * Civil::SecondsPerYear, buffer), "toISOString of a year beyond int32_t");
+        expect(!UTC::toLocalFields(TimeZone::Europe_London, std::numeric_limits<TimeT>::max()).second, "toLocalFields of a year beyond int32_t");
+    }
+
+    Log::test(Log::LF, failures ? "Failed: " : "Passed", failures ? std::to_string(failures) : std::string());
+    Log::test(std::string(LineWidth, '='), Log::LF);
+    return !failures;
+}
+
 static void bench()
 {
     Log::test(std::string(LineWidth, '='));
-    Log::test(Log::LF, "Benchmarking computations");
+    Log::test(Log::LF, "Benchmarking computations (EnableCompactRules: ", EnableCompactRules ? "true" : "false", ")");
     Log::test(std::string(LineWidth, '='));
 
     static const size_t Queries = 10000000;
@@ -110,6 +327,48 @@ static void bench()
         Log::test("Completed in ", ms.count(), "ms (", ms.count() ? Queries / ms.count() * 1000 : 0, " queries/s): ");
     }
 
+    Log::test(Log::LF, "Local calendar fields, single time zone, incremental time...");
+
+    {
+        const auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < Queries; ++i) {
+            doNotOptimizeAway(UTC::toLocalFields(TimeZone::Europe_London, now + i).first.hour);
+        }
+        const auto finish = std::chrono::steady_clock::now();
+        const auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(finish - start);
+        Log::test("Completed in ", ms.count(), "ms (", ms.count() ? Queries / ms.count() * 1000 : 0, " queries/s): ");
+    }
+
+    Log::test(Log::LF, "Local to UTC, single time zone, incremental time...");
+
+    {
+        const auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < Queries; ++i) {
+            doNotOptimizeAway(UTC::fromLocal(TimeZone::Europe_London, now + i).first);
+        }
+        const auto finish = std::chrono::steady_clock::now();
+        const auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(finish - start);
+        Log::test("Completed in ", ms.count(), "ms (", ms.count() ? Queries / ms.count() * 1000 : 0, " queries/s): ");
+    }
+
+    Log::test(Log::LF, "Batch, single time zone, incremental time...");
+
+    {
+        static const size_t BatchSize = 1000000;
+        std::vector<TimeT> utc(BatchSize);
+        std::vector<TimeT> local(BatchSize);
+        for (size_t i = 0; i < BatchSize; ++i) {
+            utc[i] = now + static_cast<TimeT>(i);
+        }
+        const auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < Queries / BatchSize; ++i) {
+            doNotOptimizeAway(UTC::toLocal(TimeZone::Europe_London, utc.data(), local.data(), BatchSize));
+        }
+        const auto finish = std::chrono::steady_clock::now();
+        const auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(finish - start);
+        Log::test("Completed in ", ms.count(), "ms (", ms.count() ? Queries / ms.count() * 1000 : 0, " queries/s): ");
+    }
+
     Log::test(Log::LF, "Round-robin each time zone, constant time...");
 
     {
@@ -123,6 +382,189 @@ static void bench()
         Log::test("Completed in ", ms.count(), "ms (", ms.count() ? Queries / ms.count() * 1000 : 0, " queries/s): ");
     }
 
+    Log::test(Log::LF, "Batch, round-robin each time zone, constant time...");
+
+    {
+        static const size_t BatchSize = 1000000;
+        std::vector<TimeZone> timeZones(BatchSize);
+        std::vector<TimeT> utc(BatchSize, now);
+        std::vector<TimeT> local(BatchSize);
+        auto tz = TimeZone::Invalid;
+        std::generate(timeZones.begin(), timeZones.end(), [&]() { return ++tz == TimeZone::Invalid ? ++tz : tz; });
+
+        const auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < Queries / BatchSize; ++i) {
+            doNotOptimizeAway(UTC::toLocal(timeZones.data(), utc.data(), local.data(), BatchSize));
+        }
+        const auto finish = std::chrono::steady_clock::now();
+        const auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(finish - start);
+        Log::test("Completed in ", ms.count(), "ms (", ms.count() ? Queries / ms.count() * 1000 : 0, " queries/s): ");
+    }
+
+    Log::test(Log::LF, "Interleaved time zones (12 in rotation), incremental time...");
+
+    {
+        static constexpr TimeZone Interleaved[] = {
+            TimeZone::America_New_York, TimeZone::America_Chicago, TimeZone::America_Denver, TimeZone::America_Los_Angeles,
+            TimeZone::America_Sao_Paulo, TimeZone::Europe_London, TimeZone::Europe_Berlin, TimeZone::Europe_Moscow,
+            TimeZone::Asia_Kolkata, TimeZone::Asia_Shanghai, TimeZone::Asia_Tokyo, TimeZone::Australia_Sydney,
+        };
+        static constexpr size_t Count = sizeof(Interleaved) / sizeof(Interleaved[0]);
+
+        const auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < Queries; ++i) {
+            doNotOptimizeAway(UTC::toLocal(Interleaved[i % Count], now + i).first);
+        }
+        const auto finish = std::chrono::steady_clock::now();
+        const auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(finish - start);
+        Log::test("Completed in ", ms.count(), "ms (", ms.count() ? Queries / ms.count() * 1000 : 0, " queries/s): ");
+    }
+
+    Log::test(Log::LF, "Single time zone, random historical time...");
+
+    {
+        std::vector<TimeT> times(1024);
+        std::mt19937_64 rng;
+        std::uniform_int_distribution<TimeT> dist(0, now);
+        std::generate(times.begin(), times.end(), [&]() { return dist(rng); });
+
+        const auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < Queries; ++i) {
+            doNotOptimizeAway(UTC::toLocal(TimeZone::America_New_York, times[i % times.size()]).first);
+        }
+        const auto finish = std::chrono::steady_clock::now();
+        const auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(finish - start);
+        Log::test("Completed in ", ms.count(), "ms (", ms.count() ? Queries / ms.count() * 1000 : 0, " queries/s): ");
+    }
+
+    // Searches over full spans with nothing for the cache to hold on to, most telling with History::ALL in data/create-includes.py...
+    Log::test(Log::LF, "Batch, random time zone, random historical time since 1900...");
+
+    {
+        static const size_t BatchSize = 1000000;
+        std::vector<TimeZone> timeZones(BatchSize);
+        std::vector<TimeT> utc(BatchSize);
+        std::vector<TimeT> local(BatchSize);
+        std::mt19937_64 rng;
+        std::uniform_int_distribution<uint16_t> zoneDist(1, static_cast<uint16_t>(UTC::CountTimeZones));
+        std::uniform_int_distribution<TimeT> timeDist(-2208988800, now);
+        std::generate(timeZones.begin(), timeZones.end(), [&]() { return TimeZone(zoneDist(rng)); });
+        std::generate(utc.begin(), utc.end(), [&]() { return timeDist(rng); });
+
+        const auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < Queries / BatchSize; ++i) {
+            doNotOptimizeAway(UTC::toLocal(timeZones.data(), utc.data(), local.data(), BatchSize));
+        }
+        const auto finish = std::chrono::steady_clock::now();
+        const auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(finish - start);
+        Log::test("Completed in ", ms.count(), "ms (", ms.count() ? Queries / ms.count() * 1000 : 0, " queries/s): ");
+    }
+
+    static const size_t Parses = Queries / 10;
+    static const std::string ISOString = "2020-11-23T19:20:21";
+
+    Log::test(Log::LF, "Parse ISO8601 string, vsscanf + mktime...");
+
+    {
+        const auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < Parses; ++i) {
+            doNotOptimizeAway(scanfFromISOString(ISOString).first);
+        }
+        const auto finish = std::chrono::steady_clock::now();
+        const auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(finish - start);
+        Log::test("Completed in ", ms.count(), "ms (", ms.count() ? Parses / ms.count() * 1000 : 0, " parses/s): ");
+    }
+
+    Log::test(Log::LF, "Parse ISO8601 string, Time::fromISOString...");
+
+    {
+        const auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < Parses; ++i) {
+            doNotOptimizeAway(Time::fromISOString(ISOString).first);
+        }
+        const auto finish = std::chrono::steady_clock::now();
+        const auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(finish - start);
+        Log::test("Completed in ", ms.count(), "ms (", ms.count() ? Parses / ms.count() * 1000 : 0, " parses/s): ");
+    }
+
+    Log::test(Log::LF, "Format ISO8601 string, gmtime_r + snprintf...");
+
+    {
+        const auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < Parses; ++i) {
+            doNotOptimizeAway(snprintfToISOString(now + i).length());
+        }
+        const auto finish = std::chrono::steady_clock::now();
+        const auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(finish - start);
+        Log::test("Completed in ", ms.count(), "ms (", ms.count() ? Parses / ms.count() * 1000 : 0, " formats/s): ");
+    }
+
+    Log::test(Log::LF, "Format ISO8601 string, Time::toISOString to caller buffer...");
+
+    {
+        std::array<char, 20> buffer {};
+        const auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < Parses; ++i) {
+            Time::toISOString(now + i, buffer);
+            doNotOptimizeAway(buffer[18]);
+        }
+        const auto finish = std::chrono::steady_clock::now();
+        const auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(finish - start);
+        Log::test("Completed in ", ms.count(), "ms (", ms.count() ? Parses / ms.count() * 1000 : 0, " formats/s): ");
+    }
+
+    {
+        static const size_t BatchSize = 1000000;
+        std::vector<TimeT> times(BatchSize);
+        std::vector<int32_t> years(BatchSize);
+        std::vector<uint8_t> months(BatchSize), days(BatchSize), hours(BatchSize), minutes(BatchSize), seconds(BatchSize), weekdays(BatchSize);
+        std::mt19937_64 rng;
+        std::uniform_int_distribution<TimeT> dist(0, now);
+        std::generate(times.begin(), times.end(), [&]() { return dist(rng); });
+
+        Log::test(Log::LF, "Calendar field columns, gmtime_r...");
+
+        {
+            const auto start = std::chrono::steady_clock::now();
+            for (size_t i = 0; i < Queries / BatchSize; ++i) {
+                for (size_t j = 0; j < BatchSize; ++j) {
+                    std::tm tm;
+                    const auto time = static_cast<std::time_t>(times[j]);
+#ifdef _MSC_VER
+                    gmtime_s(&tm, &time);
+#else
+                    gmtime_r(&time, &tm);
+#endif
+                    years[j] = tm.tm_year + 1900;
+                    months[j] = static_cast<uint8_t>(tm.tm_mon + 1);
+                    days[j] = static_cast<uint8_t>(tm.tm_mday);
+                    hours[j] = static_cast<uint8_t>(tm.tm_hour);
+                    minutes[j] = static_cast<uint8_t>(tm.tm_min);
+                    seconds[j] = static_cast<uint8_t>(tm.tm_sec);
+                    weekdays[j] = static_cast<uint8_t>(tm.tm_wday);
+                }
+                doNotOptimizeAway(years[i]);
+            }
+            const auto finish = std::chrono::steady_clock::now();
+            const auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(finish - start);
+            Log::test("Completed in ", ms.count(), "ms (", ms.count() ? Queries / ms.count() * 1000 : 0, " times/s): ");
+        }
+
+        Log::test(Log::LF, "Calendar field columns, Civil::decompose...");
+
+        {
+            const Civil::Columns columns { years.data(), months.data(), days.data(), hours.data(), minutes.data(), seconds.data(), weekdays.data() };
+            const auto start = std::chrono::steady_clock::now();
+            for (size_t i = 0; i < Queries / BatchSize; ++i) {
+                Civil::decompose(times.data(), BatchSize, columns);
+                doNotOptimizeAway(years[i]);
+            }
+            const auto finish = std::chrono::steady_clock::now();
+            const auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(finish - start);
+            Log::test("Completed in ", ms.count(), "ms (", ms.count() ? Queries / ms.count() * 1000 : 0, " times/s): ");
+        }
+    }
+
     Log::test(std::string(LineWidth, '='), Log::LF);
 }
 
@@ -144,9 +586,12 @@ int main(const int argc, const char** argv)
     Log::test("ETZ: an embeddable timezone library");
     Log::test("Build options:");
     Log::test("    CountTimeZones: ", UTC::CountTimeZones);
-    Log::test("    CountTimeZoneRules: ", UTC::CountTimeZoneRules, Log::LF);
+    Log::test("    EnableCompactRules: ", EnableCompactRules ? "true" : "false");
+    Log::test("    CountTimeZoneRules: ", UTC::CountTimeZoneRules, " (", UTC::CountTimeZoneRules * (EnableCompactRules ? 4 : 8), EnableCompactRules ? " bytes, excluding palettes)" : " bytes)");
+    Log::test("    CountTimeZoneYears: ", UTC::CountTimeZoneYears, " (", UTC::CountTimeZoneYears * sizeof(uint16_t), " bytes)", Log::LF);
 
     bool command {};
+    bool passed = true;
     if (hasOption(argv, argv + argc, "locals")) {
         locals(param(argv, argv + argc, "--utc"));
         command |= true;
@@ -155,6 +600,14 @@ int main(const int argc, const char** argv)
         timeZones();
         command |= true;
     }
+    if (hasOption(argv, argv + argc, "countries")) {
+        countries();
+        command |= true;
+    }
+    if (hasOption(argv, argv + argc, "check")) {
+        passed &= check();
+        command |= true;
+    }
     if (hasOption(argv, argv + argc, "bench")) {
         bench();
         command |= true;
@@ -164,6 +617,8 @@ int main(const int argc, const char** argv)
         Log::test("Commands:");
         Log::test("    locals     : list local time for --utc for each supported time zone");
         Log::test("    time-zones : list supported time zones");
+        Log::test("    countries  : list the time zones of each country");
+        Log::test("    check      : check conversions, exits non-zero on failure");
         Log::test("    bench      : benchmark queries");
         Log::test("    help       : this screen", Log::LF);
         Log::test("Note: ISO_DATETIME is simplified extended ISO8601-1:2019 format without decimal fractions (milliseconds), and without zone:");
@@ -171,5 +626,5 @@ int main(const int argc, const char** argv)
         Log::test("Examples:");
         Log::test("    etz-test locals --utc 2020-11-23T19:20:21");
     }
-    return 0;
+    return passed ? 0 : 1;
 }
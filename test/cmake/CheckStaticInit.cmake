@@ -0,0 +1,18 @@
+# - Fails if nm lists symbols of dynamic initialization in a file
+#
+# Run as a script, checks FILE for symbols matching PATTERN: translation
+# unit initializers (_GLOBAL__sub_I), guard variables (_ZGV) and
+# thread_local init functions (_ZTH)
+#
+#  cmake -DNM=<nm> -DFILE=<file> -DPATTERN=<regex> -P CheckStaticInit.cmake
+
+execute_process(COMMAND ${NM} ${FILE} OUTPUT_VARIABLE SYMBOLS RESULT_VARIABLE RESULT)
+if (NOT RESULT EQUAL 0)
+  message(FATAL_ERROR "${NM} ${FILE} failed")
+endif()
+
+string(REGEX MATCHALL "[^\n]*(${PATTERN})[^\n]*" FOUND "${SYMBOLS}")
+if (FOUND)
+  string(REPLACE ";" "\n" FOUND "${FOUND}")
+  message(FATAL_ERROR "Dynamic initialization in ${FILE}:\n${FOUND}")
+endif()